@@ -17,5 +17,7 @@ namespace vcsn
     automaton read_efsm_lzma(std::istream& is, const location& loc);
     // fado.cc.
     automaton read_fado(std::istream& is, const location& loc);
+    // vbin.cc.
+    automaton read_vbin(std::istream& is, const location& loc);
   }
 }
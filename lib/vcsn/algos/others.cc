@@ -97,9 +97,10 @@ namespace vcsn
     {
       auto sname = symbol{ast::normalize_context(n, false)};
       auto full_name = ast::normalize_context(n, true);
-      if (!detail::make_context_registry().get0({sname}))
-        compile(sname);
-      return detail::make_context_registry().call({sname}, full_name);
+      // Compile the context if needed, only once if concurrent.
+      auto fn = detail::make_context_registry()
+        .get({sname}, [&sname] { compile(sname); });
+      return fn(full_name);
     }
 
 
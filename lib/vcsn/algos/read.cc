@@ -32,6 +32,7 @@ namespace vcsn
         {"efsm",  r{"^#! /bin/sh"}},
         {"fado",  r{"^@([DN]FA|Transducer) "}},
         {"grail", r{"\\(START\\)"}},
+        {"vbin",  r{"^VCSNBIN$"}},
       };
     const auto daut = std::regex();
     while (is.good())
@@ -86,6 +87,7 @@ namespace vcsn
             {"efsm.bzip2", read_efsm_bzip2},
             {"efsm.lzma",  read_efsm_lzma},
             {"fado",       read_fado},
+            {"vbin",       read_vbin},
           }
         };
       auto res = map[f](is, loc);
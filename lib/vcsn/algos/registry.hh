@@ -1,7 +1,11 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include <boost/range/algorithm/sort.hpp>
 
@@ -17,6 +21,13 @@ namespace vcsn
   {
   namespace detail
   {
+    /// A registry of the implementations of an algorithm.
+    ///
+    /// Safe to use concurrently.  Registrations are rare (when a
+    /// library or a plugin is loaded), and lookups frequent: the
+    /// lookups are performed on an immutable copy of the map, without
+    /// locking.  When a lookup fails, a new copy is published if
+    /// functions were registered since the previous one.
     template <typename Fun>
     class Registry
     {
@@ -40,7 +51,9 @@ namespace vcsn
         assert(fn);
         if (debug)
           std::cerr << "Register(" << name_ << ").set(" << sig << ")\n";
+        auto&& lock = std::lock_guard<std::mutex>{mutex_};
         map_[sig] = fn;
+        dirty_ = true;
         return true;
       }
 
@@ -49,6 +62,16 @@ namespace vcsn
       {
         if (debug)
           std::cerr << "Register(" << name_ << ").get(" << sig << ")\n";
+        if (auto map = published_.load(std::memory_order_acquire))
+          {
+            auto i = map->find(sig);
+            if (i != map->end())
+              return i->second;
+          }
+        // Maybe registered since the last publication.
+        auto&& lock = std::lock_guard<std::mutex>{mutex_};
+        if (dirty_)
+          publish_();
         auto i = map_.find(sig);
         if (i == map_.end())
           return nullptr;
@@ -60,9 +83,12 @@ namespace vcsn
       std::string signatures(const signature& sig) const
       {
         auto sigs = std::vector<std::string>();
-        sigs.reserve(map_.size());
-        for (auto p: map_)
-          sigs.emplace_back(p.first.to_string());
+        {
+          auto&& lock = std::lock_guard<std::mutex>{mutex_};
+          sigs.reserve(map_.size());
+          for (auto p: map_)
+            sigs.emplace_back(p.first.to_string());
+        }
         boost::sort(sigs);
 
         auto res = std::string{};
@@ -74,33 +100,54 @@ namespace vcsn
         return res;
       }
 
-      /// Get function for signature \a sig.
+      /// Get function for signature \a sig, compiling it if needed.
       const Fun* get(const signature& sig)
+      {
+        return get(sig,
+                   [this, &sig]
+                   {
+                     try
+                       {
+                         vcsn::dyn::compile(name_, sig);
+                       }
+                     catch (const jit_error& e)
+                       {
+                         raise(e.assertions.empty()
+                               ? name_ + ": no such implementation\n"
+                               : e.assertions,
+                               signatures(sig),
+                               e.what());
+                       }
+                   });
+      }
+
+      /// Get function for signature \a sig, calling \a compile to
+      /// build and load it if needed.
+      ///
+      /// Concurrent requests for the same signature wait for a single
+      /// compilation.
+      template <typename Compile>
+      const Fun* get(const signature& sig, Compile compile)
       {
         // Maybe already loaded.
         if (auto res = get0(sig))
           return res;
         else
-          // No, try to compile it.
+          // No, try to compile it, unless someone else is doing so.
           {
-            try
-              {
-                vcsn::dyn::compile(name_, sig);
-              }
-            catch (const jit_error& e)
+            auto&& lock
+              = std::lock_guard<std::mutex>{compilation_mutex_(sig)};
+            res = get0(sig);
+            if (!res)
               {
-                raise(e.assertions.empty()
-                      ? name_ + ": no such implementation\n"
-                      : e.assertions,
-                      signatures(sig),
-                      e.what());
+                compile();
+                res = get0(sig);
+                VCSN_REQUIRE(res,
+                             name_,
+                             ": compilation succeeded, "
+                             "but function is unavailable\n",
+                             signatures(sig));
               }
-            res = get0(sig);
-            VCSN_REQUIRE(res,
-                         name_,
-                         ": compilation succeeded, "
-                         "but function is unavailable\n",
-                         signatures(sig));
             return res;
           }
       }
@@ -126,11 +173,43 @@ namespace vcsn
       }
 
     private:
-      /// Function name (e.g., "determinize").
-      std::string name_;
       /// Signature -> pointer to implementation.
       using map_t = std::unordered_map<signature, Fun*>;
+
+      /// Make the current version of map_ visible to lock-free lookups.
+      ///
+      /// Readers might still be using the previous versions: keep
+      /// them.  There are as many as libraries and plugins loaded.
+      ///
+      /// \pre mutex_ is locked.
+      void publish_()
+      {
+        versions_.emplace_back(std::make_unique<const map_t>(map_));
+        published_.store(versions_.back().get(), std::memory_order_release);
+        dirty_ = false;
+      }
+
+      /// The mutex that serializes the compilations of \a sig.
+      std::mutex& compilation_mutex_(const signature& sig)
+      {
+        auto&& lock = std::lock_guard<std::mutex>{mutex_};
+        return compilations_[sig];
+      }
+
+      /// Function name (e.g., "determinize").
+      std::string name_;
+      /// Protects map_, dirty_, versions_ and compilations_.
+      mutable std::mutex mutex_;
+      /// All the registered functions.
       map_t map_;
+      /// Whether map_ has changed since its last publication.
+      bool dirty_ = false;
+      /// The published versions of map_.
+      std::vector<std::unique_ptr<const map_t>> versions_;
+      /// The latest published version, for lock-free lookups.
+      std::atomic<const map_t*> published_{nullptr};
+      /// The signatures being (or once) compiled.
+      std::unordered_map<signature, std::mutex> compilations_;
     };
   }
   }
@@ -0,0 +1,27 @@
+#include <lib/vcsn/algos/fwd.hh>
+#include <lib/vcsn/algos/registry.hh>
+#include <vcsn/algos/vbin.hh>
+#include <vcsn/dyn/algos.hh>
+#include <vcsn/dyn/automaton.hh>
+#include <vcsn/dyn/context.hh>
+#include <vcsn/dyn/registries.hh>
+
+namespace vcsn
+{
+  namespace dyn
+  {
+
+    /*------------.
+    | read_vbin.  |
+    `------------*/
+
+    REGISTRY_DEFINE(read_vbin);
+
+    automaton
+    read_vbin(std::istream& is, const location&)
+    {
+      auto ctx = make_context(vcsn::detail::vbin_read_header(is));
+      return detail::read_vbin_registry().call(ctx, is);
+    }
+  }
+}
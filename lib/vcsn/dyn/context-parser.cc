@@ -248,6 +248,8 @@ namespace vcsn
           return std::make_shared<letterset>(genset_());
         else if (ls == "law" || ls == "wordset")
           return std::make_shared<wordset>(genset_());
+        else if (ls == "lawi" || ls == "interned_wordset")
+          return std::make_shared<interned_wordset>(genset_());
         else if (ls == "nullableset")
           {
             eat_('<');
@@ -333,8 +335,9 @@ namespace vcsn
             res->get_content().emplace_back(any_());
             eat_('>');
           }
-        // mutable_automaton<Context>.
-        else if (prefix == "mutable_automaton")
+        // xxx_automaton<Context>.
+        else if (prefix == "frozen_automaton"
+                 || prefix == "mutable_automaton")
           {
             eat_('<');
             res = std::make_shared<automaton>(prefix, context_());
@@ -486,16 +489,19 @@ namespace vcsn
           "log",
           "nmin",
           "q",
+          "qh",
           "qmp",
           "r",
           "rmin",
           "z",
+          "zh",
           "zmin",
         };
 
       /// The set of weightset names.
       std::set<std::string> labelsets_ =
         {
+          "interned_wordset",
           "lal",
           "lal_char",
           "lan",
@@ -503,6 +509,7 @@ namespace vcsn
           "lao",
           "law",
           "law_char",
+          "lawi",
           "letterset",
           "nullableset",
           "wordset",
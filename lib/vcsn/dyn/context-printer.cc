@@ -61,6 +61,7 @@ namespace vcsn
             {"expression_automaton"   , "vcsn/core/expression-automaton.hh"},
             {"filter_automaton"       , "vcsn/algos/filter.hh"},
             {"focus_automaton"        , "vcsn/algos/focus.hh"},
+            {"frozen_automaton"       , "vcsn/core/frozen-automaton.hh"},
             {"insplit_automaton"      , "vcsn/algos/insplit.hh"},
             {"lazy_proper_automaton"  , "vcsn/algos/epsilon-remover-lazy.hh"},
             {"mutable_automaton"      , "vcsn/core/mutable-automaton.hh"},
@@ -154,6 +155,14 @@ namespace vcsn
       os_ << "vcsn::set_alphabet<vcsn::" << t.letter_type() << '>';
     }
 
+    DEFINE(interned_wordset)
+    {
+      header("vcsn/labelset/interned-wordset.hh");
+      os_ << "vcsn::interned_wordset<";
+      t.genset()->accept(*this);
+      os_ << '>';
+    }
+
     DEFINE(letterset)
     {
       header("vcsn/labelset/letterset.hh");
@@ -181,7 +190,9 @@ namespace vcsn
     DEFINE(weightset)
     {
       header("vcsn/weightset/" + t.get_type() + ".hh");
-      if (t.get_type() == "qmp")
+      if (t.get_type() == "qh"
+          || t.get_type() == "qmp"
+          || t.get_type() == "zh")
         linkflags("-lgmp -lgmpxx");
       os_ << "vcsn::" << t.get_type();
     }
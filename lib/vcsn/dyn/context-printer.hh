@@ -39,6 +39,7 @@ namespace vcsn
       DEFINE(expansionset);
       DEFINE(expressionset);
       DEFINE(genset);
+      DEFINE(interned_wordset);
       DEFINE(letterset);
       DEFINE(nullableset);
       DEFINE(oneset);
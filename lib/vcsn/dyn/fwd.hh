@@ -11,6 +11,7 @@ namespace vcsn
     class expansionset;
     class expressionset;
     class genset;
+    class interned_wordset;
     class letterset;
     class nullableset;
     class oneset;
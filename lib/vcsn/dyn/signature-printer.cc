@@ -90,6 +90,13 @@ namespace vcsn
         os_ << t.generators();
     }
 
+    DEFINE(interned_wordset)
+    {
+      os_ << "interned_wordset<";
+      t.genset()->accept(*this);
+      os_ << '>';
+    }
+
     DEFINE(letterset)
     {
       os_ << "letterset<";
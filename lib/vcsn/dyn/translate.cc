@@ -1,12 +1,18 @@
 #include <lib/vcsn/dyn/translate.hh>
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <fstream>
+#include <iomanip>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
-#include <unistd.h> // getpid
+#include <fcntl.h> // open
+#include <sys/file.h> // flock
+#include <unistd.h> // getpid, close
 
 #include <boost/algorithm/string/case_conv.hpp>
 #include <boost/filesystem.hpp>
@@ -59,7 +65,10 @@ namespace vcsn
         if (auto cp = getenv(envvar.c_str()))
           return cp;
         else
-          return get_config()["configuration"][var].str();
+          {
+            auto&& lock = std::lock_guard<std::mutex>{get_config_mutex()};
+            return get_config()["configuration"][var].str();
+          }
       }
 
       /// Expand initial "~" in res.
@@ -89,14 +98,113 @@ namespace vcsn
         boost::filesystem::create_directories(p.parent_path());
       }
 
-      /// Append ".PID".
+      /// Append ".PID", and a thread number if needed.
+      ///
+      /// Several threads may compile concurrently, each one needs its
+      /// own temporary files.
       std::string tmpname(std::string res)
       {
+        static std::atomic<unsigned> num_threads{0};
+        static thread_local unsigned thread = num_threads++;
         res += ".";
         res += std::to_string(getpid());
+        if (thread)
+          res += "-" + std::to_string(thread);
+        return res;
+      }
+
+      /// A hash of \a s, as an hexadecimal string.
+      ///
+      /// Use FNV-1a rather than std::hash: the result must not depend
+      /// on the host, or the library implementation.
+      std::string stable_hash(const std::string& s)
+      {
+        auto res = uint64_t{0xcbf29ce484222325};
+        for (unsigned char c: s)
+          {
+            res ^= c;
+            res *= uint64_t{0x100000001b3};
+          }
+        auto o = std::ostringstream{};
+        o << std::hex << std::setw(16) << std::setfill('0') << res;
+        return o.str();
+      }
+
+      /// The key of the current build configuration.
+      ///
+      /// Plugins built by another compiler, with other flags, or
+      /// against another version of Vcsn cannot be mixed with ours:
+      /// each configuration has its own plugin directory, named after
+      /// this key.  Since the path of a plugin within this directory
+      /// is its signature, the location of a plugin is determined by
+      /// (signature, compiler, flags, version), so that plugin
+      /// caches can be shared safely between hosts.
+      const std::string& build_key()
+      {
+        static const auto res = []
+          {
+            auto key = std::string{};
+            for (auto var: {"cxx", "cxxflags", "cppflags", "ldflags",
+                            "version"})
+              key += config(var) + '\n';
+            return stable_hash(key);
+          }();
         return res;
       }
 
+      /// The modification time of \a file, or 0 if it does not exist.
+      std::time_t mtime(const std::string& file)
+      {
+        auto ec = boost::system::error_code{};
+        auto res = boost::filesystem::last_write_time(file, ec);
+        return ec ? 0 : res;
+      }
+
+      /// An exclusive lock on a file, to prevent concurrent processes
+      /// from building the same plugin.
+      class file_lock
+      {
+      public:
+        /// Lock \a file (created if needed), waiting if needed.
+        file_lock(const std::string& file)
+          : fd_{::open(file.c_str(), O_RDWR | O_CREAT, 0666)}
+        {
+          // If we cannot lock, proceed anyway: the temporary files
+          // and the atomic renames still ensure correctness, locks
+          // only avoid useless work.
+          if (0 <= fd_)
+            {
+              waited_ = ::flock(fd_, LOCK_EX | LOCK_NB) != 0;
+              if (waited_ && ::flock(fd_, LOCK_EX) != 0)
+                {
+                  ::close(fd_);
+                  fd_ = -1;
+                }
+            }
+        }
+
+        file_lock(const file_lock&) = delete;
+
+        ~file_lock()
+        {
+          if (0 <= fd_)
+            {
+              ::flock(fd_, LOCK_UN);
+              ::close(fd_);
+            }
+        }
+
+        /// Whether we had to wait for another process.
+        bool waited() const
+        {
+          return waited_;
+        }
+
+      private:
+        int fd_;
+        bool waited_ = false;
+      };
+
       struct translation
       {
         translation()
@@ -252,7 +360,53 @@ namespace vcsn
           auto res = xgetenv("VCSN_PLUGINDIR",
                              xgetenv("VCSN_HOME", "~/.vcsn") + "/plugins");
           res = expand_tilda(res);
-          return res + "/";
+          return res + "/" + build_key() + "/";
+        }
+
+        /// Load the plugin \a base from a read-only cache, if
+        /// available.
+        ///
+        /// $VCSN_PLUGINPATH is a colon-separated list of plugin
+        /// directories (with the same layout as $VCSN_PLUGINDIR),
+        /// typically shared between hosts, which are never written
+        /// to.
+        ///
+        /// \returns whether the plugin was loaded.
+        bool load_shared(const std::string& base) const
+        {
+          auto path = xgetenv("VCSN_PLUGINPATH");
+          if (path.empty())
+            return false;
+          const auto name = base.substr(plugindir().size());
+          auto dirs = std::istringstream{path};
+          for (auto dir = std::string{}; std::getline(dirs, dir, ':');)
+            if (!dir.empty())
+              {
+                auto so = (expand_tilda(dir) + "/" + build_key() + "/"
+                           + name + ".so");
+                if (boost::filesystem::exists(so))
+                  {
+                    if (verbose)
+                      std::cerr << "vcsn: loading " << so << '\n';
+                    load(so);
+                    return true;
+                  }
+              }
+          return false;
+        }
+
+        /// Load a plugin.
+        ///
+        /// libltdl is not thread-safe: load one plugin at a time.
+        void load(const std::string& so) const
+        {
+          static std::mutex mutex;
+          auto&& lock = std::lock_guard<std::mutex>{mutex};
+          vcsn::detail::xlt_advise()
+            .global(true)
+            .ext()
+            .verbose(1 < verbose)
+            .open(so);
         }
 
         /// Split file names that are too long into something with '/'
@@ -272,8 +426,10 @@ namespace vcsn
 
         /// Compile and load a C++ file.
         ///
-        /// Avoid locks, but avoid races by using temporary files, and
-        /// using rename, which is atomic.
+        /// Avoid races by using temporary files, and using rename,
+        /// which is atomic.  In addition, lock the plugin, so that
+        /// concurrent processes do not compile it several times: the
+        /// one that waited just loads it.
         ///
         /// Break the compilation/linking in two steps, in case we
         /// are using ccache, which does not handle
@@ -281,53 +437,59 @@ namespace vcsn
         void jit(const std::string& base)
         {
           auto tmp = tmpname(base);
-          {
-            namespace chr = std::chrono;
-            using clock = chr::steady_clock;
-            auto start = clock::now();
-            static bool no_python = !!getenv("VCSN_NO_PYTHON");
-            if (no_python)
-              {
-                cxx_compile(base);
-                cxx_link(base);
-                boost::filesystem::rename(tmp + ".so", base + ".so");
-                // Upon success, remove the .o file, it is large (10x
-                // compared to the *.so on erebus using clang) and not
-                // required.  However the debug symbols are in there, so
-                // when debugging, leave them!
-                if (!getenv("VCSN_DEBUG"))
-                  boost::filesystem::remove(tmp + ".o");
-              }
-            else
-              {
-                auto cmd
-                  = xgetenv("VCSN_COMPILE",
-                            xgetenv("VCSN", "vcsn") + " compile");
-                auto linkflags = printer_.linkflags();
-                if (!linkflags.empty())
-                  linkflags = " LDFLAGS+='" + linkflags + "'";
-                cxx(cmd + " -shared" + linkflags + " '" + base + ".cc'",
-                    tmp);
-              }
-            auto d
-              = chr::duration_cast<chr::milliseconds>(clock::now() - start);
-            if (getenv("VCSN_TIME"))
-              {
-                std::ofstream{"/tmp/vcsn-compile.log",
-                    std::ofstream::out | std::ofstream::app}
-                << d.count() << ", "
-                << (no_python ? "C++, " : "Py,  ")
-                << '\'' << base.substr(plugindir().size()) << '\''
-                << '\n';
-                if (getenv("VCSN_TIME2"))
-                  std::cerr << d.count() << "ms: " << base << '\n';
-              }
-          }
-          vcsn::detail::xlt_advise()
-            .global(true)
-            .ext()
-            .verbose(1 < verbose)
-            .open(base + ".so");
+          const auto so_mtime = mtime(base + ".so");
+          file_lock lock{base + ".lock"};
+          if (lock.waited()
+              && so_mtime < mtime(base + ".so")
+              && mtime(base + ".cc") <= mtime(base + ".so"))
+            {
+              if (verbose)
+                std::cerr << "vcsn: built concurrently: " << base << '\n';
+            }
+          else
+            {
+              namespace chr = std::chrono;
+              using clock = chr::steady_clock;
+              auto start = clock::now();
+              static bool no_python = !!getenv("VCSN_NO_PYTHON");
+              if (no_python)
+                {
+                  cxx_compile(base);
+                  cxx_link(base);
+                  boost::filesystem::rename(tmp + ".so", base + ".so");
+                  // Upon success, remove the .o file, it is large (10x
+                  // compared to the *.so on erebus using clang) and not
+                  // required.  However the debug symbols are in there, so
+                  // when debugging, leave them!
+                  if (!getenv("VCSN_DEBUG"))
+                    boost::filesystem::remove(tmp + ".o");
+                }
+              else
+                {
+                  auto cmd
+                    = xgetenv("VCSN_COMPILE",
+                              xgetenv("VCSN", "vcsn") + " compile");
+                  auto linkflags = printer_.linkflags();
+                  if (!linkflags.empty())
+                    linkflags = " LDFLAGS+='" + linkflags + "'";
+                  cxx(cmd + " -shared" + linkflags + " '" + base + ".cc'",
+                      tmp);
+                }
+              auto d
+                = chr::duration_cast<chr::milliseconds>(clock::now() - start);
+              if (getenv("VCSN_TIME"))
+                {
+                  std::ofstream{"/tmp/vcsn-compile.log",
+                      std::ofstream::out | std::ofstream::app}
+                  << d.count() << ", "
+                  << (no_python ? "C++, " : "Py,  ")
+                  << '\'' << base.substr(plugindir().size()) << '\''
+                  << '\n';
+                  if (getenv("VCSN_TIME2"))
+                    std::cerr << d.count() << "ms: " << base << '\n';
+                }
+            }
+          load(base + ".so");
         }
 
         /// Compile, and load, a DSO with instantiations for \a ctx.
@@ -335,6 +497,8 @@ namespace vcsn
         {
           printer_.header("vcsn/ctx/instantiate.hh");
           auto base = plugindir() + "contexts/" + split(ctx);
+          if (load_shared(base))
+            return;
           os << "using ctx_t =" << incendl;
           print_context(ctx);
           os << ';' << decendl
@@ -353,6 +517,15 @@ namespace vcsn
         void
         operator()(const std::set<std::pair<std::string, signature>>& algos)
         {
+          // The first algo is the once that gives its name to the
+          // file to compile.
+          auto base = (plugindir()
+                       + "algos/"
+                       + begin(algos)->first + "/"
+                       + split(begin(algos)->second.to_string()));
+          if (load_shared(base))
+            return;
+
           printer_.header("vcsn/misc/attributes.hh"); // ATTRIBUTE_USED
           printer_.header("vcsn/dyn/name.hh"); // ssignature
           printer_.header("vcsn/dyn/registries.hh");
@@ -390,12 +563,6 @@ namespace vcsn
                  << ");" << decendl;
             }
 
-          // The first algo is the once that gives its name to the
-          // file to compile.
-          auto base = (plugindir()
-                       + "algos/"
-                       + begin(algos)->first + "/"
-                       + split(begin(algos)->second.to_string()));
           print(base);
           jit(base);
         }
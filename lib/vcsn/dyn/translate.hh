@@ -3,11 +3,12 @@
 #include <stdexcept>
 #include <string>
 
+#include <vcsn/misc/export.hh>
 #include <vcsn/misc/fwd.hh>
 
 namespace vcsn
 {
-  namespace dyn
+  namespace dyn LIBVCSN_API
   {
     /// An exception suited for our compilation errors.
     struct jit_error: std::runtime_error
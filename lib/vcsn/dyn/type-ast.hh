@@ -194,6 +194,28 @@ namespace vcsn
     };
 
 
+    /// Support for interned_wordset<GenSet>.
+    class interned_wordset: public ast_node
+    {
+    public:
+      interned_wordset(const std::shared_ptr<const ast_node>& gs)
+        : gs_(gs)
+      {}
+
+      /// The generator set.
+      std::shared_ptr<const ast_node> genset() const
+      {
+        return gs_;
+      }
+
+      ACCEPT()
+      virtual bool has_one() const { return true; }
+
+    private:
+      const std::shared_ptr<const ast_node> gs_;
+    };
+
+
     /// Support for wordset<GenSet>.
     class wordset: public ast_node
     {
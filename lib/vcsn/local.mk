@@ -47,7 +47,8 @@ algo_implems =                                  \
   %D%/algos/others.cc                           \
   %D%/algos/print.cc                            \
   %D%/algos/read.cc                             \
-  %D%/algos/registry.hh
+  %D%/algos/registry.hh                         \
+  %D%/algos/vbin.cc
 
 lib_libvcsn_la_SOURCES =                        \
   $(algo_implems)                               \
@@ -69,6 +70,7 @@ lib_libvcsn_la_SOURCES =                        \
   %D%/misc/flex-lexer.hh                        \
   %D%/misc/format.cc                            \
   %D%/misc/indent.cc                            \
+  %D%/misc/mapped-file.cc                       \
   %D%/misc/random.cc                            \
   %D%/misc/signature.cc                         \
   %D%/misc/stream.cc                            \
@@ -174,6 +174,7 @@ namespace vcsn
 
   std::string configuration(const std::string& key)
   {
+    auto&& lock = std::lock_guard<std::mutex>{get_config_mutex()};
     // We need a unique_pointers because subscripting returns rvalues.
     auto config = std::make_unique<detail::config::value>(get_config());
     auto subkeys = std::vector<std::string>{};
@@ -0,0 +1,78 @@
+#include <vcsn/misc/mapped-file.hh>
+
+#include <cerrno>
+#include <cstring> // strerror
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <vcsn/misc/raise.hh>
+#include <vcsn/misc/stream.hh> // open_input_file
+
+namespace vcsn
+{
+  namespace
+  {
+    /// An input stream on a file mapped in memory.
+    class mapped_istream: public std::istream
+    {
+    public:
+      mapped_istream(const std::string& file, int fd, size_t size)
+        : std::istream{nullptr}
+        , size_{size}
+      {
+        data_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        VCSN_REQUIRE(data_ != MAP_FAILED,
+                     "cannot map ", file, ": ", strerror(errno));
+        // The readers mostly scan the file once, from the beginning.
+        madvise(data_, size_, MADV_SEQUENTIAL);
+        auto begin = static_cast<const char*>(data_);
+        buf_.reset(new memory_streambuf{begin, begin + size_});
+        rdbuf(buf_.get());
+      }
+
+      mapped_istream(const mapped_istream&) = delete;
+
+      ~mapped_istream()
+      {
+        munmap(data_, size_);
+      }
+
+    private:
+      void* data_;
+      size_t size_;
+      std::unique_ptr<memory_streambuf> buf_;
+    };
+
+    /// A file descriptor closed on destruction.
+    struct file_descriptor
+    {
+      ~file_descriptor()
+      {
+        if (fd != -1)
+          close(fd);
+      }
+      int fd;
+    };
+  }
+
+  std::shared_ptr<std::istream>
+  open_mapped_file(const std::string& file)
+  {
+    if (file.empty() || file == "-")
+      return open_input_file(file);
+    auto fd = file_descriptor{open(file.c_str(), O_RDONLY)};
+    VCSN_REQUIRE(fd.fd != -1,
+                 "cannot open ", file, " for reading: ", strerror(errno));
+    struct stat st;
+    VCSN_REQUIRE(fstat(fd.fd, &st) == 0,
+                 "cannot stat ", file, ": ", strerror(errno));
+    // Empty files cannot be mapped, and pipes cannot be mapped at all.
+    if (!S_ISREG(st.st_mode) || !st.st_size)
+      return open_input_file(file);
+    // The mapping survives the closing of the file descriptor.
+    return std::make_shared<mapped_istream>(file, fd.fd, st.st_size);
+  }
+}
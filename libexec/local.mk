@@ -14,6 +14,7 @@
 # Our scripts that are actually in Python.
 python_scripts =                                \
   %D%/vcsn-compile                              \
+  %D%/vcsn-precompile                           \
   %D%/vcsn-ps                                   \
   %D%/vcsn-score                                \
   %D%/vcsn-score-compare
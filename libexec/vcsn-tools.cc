@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <string>
 #include <unistd.h>
 
@@ -6,6 +8,7 @@
 #include <boost/range/algorithm/transform.hpp>
 
 #include <vcsn/dyn/algos.hh>
+#include <vcsn/misc/mapped-file.hh>
 #include <vcsn/misc/stream.hh> // get_file_contents().
 
 #include "vcsn-tools.hh"
@@ -220,6 +223,83 @@ namespace
       }
   }
 
+  /// Run `vcsn evaluate --stream`: evaluate large texts without
+  /// loading them.
+  ///
+  /// The automaton is read from the `-f` argument (default: standard
+  /// input), and the texts from the remaining arguments (default:
+  /// standard input).
+  int evaluate_stream(int argc, char** argv)
+  {
+    // Skip the program and the function names, and --stream.
+    auto args = std::vector<char*>{argv[0]};
+    std::remove_copy(argv + 2, argv + argc, std::back_inserter(args),
+                     std::string("--stream"));
+    argc = args.size();
+    argv = args.data();
+
+    auto aut_file = std::string{"-"};
+    auto input_format = std::string{"default"};
+    auto output_file = std::string{};
+    auto output_format = std::string{"default"};
+    auto mode = std::string{"lines"};
+
+    const char optstring[] =
+#ifdef __GNU_LIBRARY__
+      // Put GNU getopt() in POSIXLY_CORRECT mode.
+      "+"
+#endif
+      "f:I:m:O:o:q";
+    // Don't let getopt display error messages.
+    opterr = 0;
+    for (auto opt = 0; (opt = getopt(argc, argv, optstring)) != -1;)
+      switch (opt)
+        {
+        case 'f':
+          aut_file = optarg;
+          break;
+        case 'I':
+          input_format = optarg;
+          break;
+        case 'm':
+          mode = optarg;
+          break;
+        case 'O':
+          output_format = optarg;
+          break;
+        case 'o':
+          output_file = optarg;
+          break;
+        case 'q':
+          output_file = "/dev/null";
+          break;
+        case '?':
+          raise("invalid option: -", char(optopt));
+        }
+
+    auto texts = std::vector<std::string>(argv + optind, argv + argc);
+    if (texts.empty())
+      texts.emplace_back("-");
+    require(aut_file != "-"
+            || std::count(begin(texts), end(texts), "-") == 0,
+            "evaluate: cannot read both the automaton and the text"
+            " from the standard input");
+
+    auto aut = [&]
+      {
+        auto is = open_input_file(aut_file);
+        return dyn::read_automaton(*is, input_format);
+      }();
+    auto out = std::shared_ptr<std::ostream>{};
+    if (!output_file.empty())
+      out = open_output_file(output_file);
+    auto& os = out ? *out : std::cout;
+    dyn::set_format(os, output_format);
+    for (const auto& t: texts)
+      dyn::evaluate_stream(aut, *open_mapped_file(t), os, mode);
+    return 0;
+  }
+
   int
   list_commands()
   {
@@ -303,6 +383,13 @@ namespace
          "  -o FILE       save output into FILE\n"
          "  -q            discard any output\n"
          "\n"
+         "Streaming Evaluation:\n"
+         "  vcsn evaluate --stream [-f AUTOMATON] [-m MODE] [FILE...]\n"
+         "                evaluate the texts in FILEs (or the standard input)\n"
+         "                without loading them.  MODE is 'lines' (the weight\n"
+         "                of each line, the default) or 'positions' (the end\n"
+         "                positions of the factors with a non-zero weight)\n"
+         "\n"
          "Input/Output Formats (for Automata, Expressions, Labels, Polynomials, Weights):\n"
          "  daut   A      Simplified Dot syntax for Automata\n"
          "  dot    A      GraphViz's Dot language\n"
@@ -328,6 +415,9 @@ namespace
          "      vcsn determinize -f - |\n"
          "      vcsn evaluate -f - -L 'abba'\n"
          "\n"
+         "  $ vcsn derived-term -Ee '[ab]*a[ab]{3}' |\n"
+         "      vcsn evaluate --stream -f - -m positions text.txt\n"
+         "\n"
          "  $ vcsn derived-term -C 'lat<lan, lan>, q' -Ee 'a*|b*' |\n"
          "      vcsn shortest 10\n";
     }
@@ -355,6 +445,11 @@ try
           || argv[2] == std::string("-h")))
     return print_usage(algo);
 
+  if (algo == "evaluate"
+      && std::find(argv + 2, argv + argc, std::string("--stream"))
+         != argv + argc)
+    return evaluate_stream(argc, argv);
+
   auto options = parse_arguments(argc, argv);
 
   auto out = std::shared_ptr<std::ostream>{};
@@ -207,6 +207,13 @@ class automaton:
         else:
             raise ValueError('invalid display format: ' + mode)
 
+    _compose_orig = automaton.compose
+
+    def compose(self, other, algo="auto", lazy=False):
+        if lazy:
+            algo = 'lazy'
+        return self._compose_orig(other, algo)
+
     _determinize_orig = automaton.determinize
 
     def determinize(self, algo="auto", lazy=False):
@@ -267,6 +274,8 @@ class automaton:
 
     # automaton.format
     def format(self, fmt="daut"):
+        if fmt == 'vbin':
+            return self._format_bytes(fmt)
         return self._format(fmt)
 
     def __format__(self, spec):
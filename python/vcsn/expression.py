@@ -95,6 +95,28 @@ class expression:
         return self._derivation(w, *args)
 
 
+    def match(self, w):
+        '''The weight of word `w`, computed with a lazy deterministic
+        automaton, with possible conversion from plain string to genuine
+        label object.
+        '''
+        c = self.context()
+        if not isinstance(w, label):
+            w = c.word(str(w))
+        return self._match(w)
+
+
+    def search(self, w):
+        '''The first factor of word `w` whose weight is not zero, as the
+        pair of positions of its first letter and past its last letter,
+        or None.
+        '''
+        c = self.context()
+        if not isinstance(w, label):
+            w = c.word(str(w))
+        return self._search(w)
+
+
     _derived_term_orig = expression.derived_term
     def derived_term(self, algo="expansion",
                      lazy=False, deterministic=False, breaking=False):
@@ -34,9 +34,80 @@
 
 #include <vcsn/odyn/odyn.hh>
 #include <vcsn/dyn/algos.hh>
+#include <vcsn/misc/signature.hh>
+#include <lib/vcsn/dyn/translate.hh>
 
 using namespace vcsn::odyn;
 
+/// Release the GIL during the lifetime of this object.
+///
+/// Our algorithms do not use Python objects, and some are long to run
+/// (or to compile): let other Python threads run meanwhile.
+class gil_release
+{
+public:
+  gil_release()
+    : state_{PyEval_SaveThread()}
+  {}
+
+  gil_release(const gil_release&) = delete;
+
+  ~gil_release()
+  {
+    PyEval_RestoreThread(state_);
+  }
+
+private:
+  PyThreadState* state_;
+};
+
+/// Whether \a aut has lazy states.  Their computation, even by
+/// "const" algorithms, modifies the automaton: it must remain
+/// protected by the GIL.
+inline bool has_lazy_states(const automaton& aut)
+{
+  return aut.val_->has_lazy_states();
+}
+
+template <typename Value>
+bool has_lazy_states(const Value&)
+{
+  return false;
+}
+
+/// Call the member function \a Fun without the GIL, unless one of
+/// its arguments is a lazy automaton.
+template <typename Type, Type Fun>
+struct without_gil;
+
+template <typename Res, typename Value, typename... Args,
+          Res (Value::*Fun)(Args...) const>
+struct without_gil<Res (Value::*)(Args...) const, Fun>
+{
+  static Res call(const Value& v, Args... args)
+  {
+    auto lazy = false;
+    for (auto l: {has_lazy_states(v), has_lazy_states(args)...})
+      lazy |= l;
+    if (lazy)
+      return (v.*Fun)(std::forward<Args>(args)...);
+    else
+      {
+        auto&& release = gil_release{};
+        return (v.*Fun)(std::forward<Args>(args)...);
+      }
+  }
+};
+
+/// Bind member function \a Fun, to be called without the GIL.
+#define NOGIL(Fun)                              \
+  &without_gil<decltype(&Fun), &Fun>::call
+
+/// Bind member function \a Fun, to be called without the GIL.  \a Type
+/// selects an overload.
+#define NOGIL_AS(Type, Fun)                     \
+  &without_gil<Type, &Fun>::call
+
 /// The type of the repeated conjunction function.
 using automaton_conjunction_repeated_t
   = auto (automaton::*)(unsigned n) const -> automaton;
@@ -110,6 +181,29 @@ std::string format(const Value& v,
   return vcsn::dyn::format(v.val_, format);
 }
 
+/// Convert this value to bytes, for binary formats.
+template <typename Value>
+boost::python::object format_bytes(const Value& v,
+                                   const std::string& format)
+{
+  namespace bp = boost::python;
+  auto res = vcsn::dyn::format(v.val_, format);
+  return bp::object{bp::handle<>{PyBytes_FromStringAndSize(res.data(),
+                                                           res.size())}};
+}
+
+/// Compile, and load, the plugin for \a algo on \a sig.
+///
+/// Used by `vcsn precompile`.
+void compile_plugin(const std::string& algo, const boost::python::list& sig)
+{
+  auto s = vcsn::signature{};
+  for (const auto& t: make_vector<std::string>(sig))
+    s.sig.emplace_back(t);
+  auto&& release = gil_release{};
+  vcsn::dyn::compile(algo, s);
+}
+
 label context_word(const context& ctx, const std::string& s)
 {
   return label(context(vcsn::dyn::make_word_context(ctx.val_)), s);
@@ -125,12 +219,32 @@ expression context_random_expression(const context& ctx,
 automaton automaton_conjunction(const boost::python::list& l,
                                 bool lazy = false)
 {
-  return automaton::conjunction(make_vector<automaton>(l), lazy);
+  auto auts = make_vector<automaton>(l);
+  auto&& release = gil_release{};
+  return automaton::conjunction(auts, lazy);
 }
 
 automaton automaton_infiltrate(const boost::python::list& l)
 {
-  return automaton::infiltrate(make_vector<automaton>(l));
+  auto auts = make_vector<automaton>(l);
+  auto&& release = gil_release{};
+  return automaton::infiltrate(auts);
+}
+
+boost::python::list automaton_evaluate_batch(const automaton& aut,
+                                             const boost::python::list& words,
+                                             unsigned num_threads = 1)
+{
+  auto ws = make_vector<std::string>(words);
+  auto weights = [&]
+    {
+      auto&& release = gil_release{};
+      return aut.evaluate_batch(ws, num_threads);
+    }();
+  auto res = boost::python::list{};
+  for (const auto& w: weights)
+    res.append(w);
+  return res;
 }
 
 automaton automaton_filter(const automaton& aut,
@@ -148,13 +262,16 @@ automaton automaton_lift(const automaton& aut,
 
 automaton automaton_shuffle(const boost::python::list& l)
 {
-  return automaton::shuffle(make_vector<automaton>(l));
+  auto auts = make_vector<automaton>(l);
+  auto&& release = gil_release{};
+  return automaton::shuffle(auts);
 }
 
 expression automaton_expression(const automaton& aut,
                                 const std::string& ids = "default",
                                 const std::string& algo = "auto")
 {
+  auto&& release = gil_release{};
   return aut.to_expression(ids, algo);
 }
 
@@ -179,6 +296,21 @@ expansion expansion_tuple(const boost::python::list& l)
   return expansion::tuple(make_vector<expansion>(l));
 }
 
+/// The first factor of \a w matched by \a e, as a pair of
+/// positions, or None.
+boost::python::object expression_search(const expression& e, const label& w)
+{
+  auto res = [&]
+    {
+      auto&& release = gil_release{};
+      return e.search(w);
+    }();
+  if (res.empty())
+    return {};
+  else
+    return boost::python::make_tuple(res[0], res[1]);
+}
+
 expression expression_tuple(const boost::python::list& l)
 {
   return expression::tuple(make_vector<expression>(l));
@@ -324,6 +456,7 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
   python_string__enum<identities>();
 
   // Free functions.
+  bp::def("compile_plugin", &compile_plugin);
   bp::def("configuration", &vcsn::dyn::configuration);
 
   // We use bp::no_init to disable the use of the default ctor from
@@ -336,21 +469,22 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
          ((arg("data") = "", arg("format") = "default",
            arg("filename") = "", arg("strip") = true)))
     .def("accessible", &automaton::accessible)
-    .def("add", &automaton::add, (arg("algo") = "auto"))
-    .def("ambiguous_word", &automaton::ambiguous_word)
+    .def("add", NOGIL(automaton::add), (arg("algo") = "auto"))
+    .def("ambiguous_word", NOGIL(automaton::ambiguous_word))
     .def("automaton", static_cast<automaton_copy_t>(&automaton::copy))
     .def("focus", &automaton::focus)
     .def("coaccessible", &automaton::coaccessible)
-    .def("codeterminize", &automaton::codeterminize, (arg("algo") = "auto"))
-    .def("cominimize", &automaton::cominimize, (arg("algo") = "auto"))
+    .def("codeterminize", NOGIL(automaton::codeterminize),
+         (arg("algo") = "auto"))
+    .def("cominimize", NOGIL(automaton::cominimize), (arg("algo") = "auto"))
     .def("compare", &automaton::compare)
     .def("complement", &automaton::complement)
     .def("complete", &automaton::complete)
     .def("component", &automaton::component)
-    .def("compose", &automaton::compose, (arg("lazy") = false))
+    .def("compose", NOGIL(automaton::compose), (arg("algo") = "auto"))
     .def("condense", &automaton::condense)
     .def("conjunction",
-         static_cast<automaton_conjunction_repeated_t>(&automaton::conjunction))
+         NOGIL_AS(automaton_conjunction_repeated_t, automaton::conjunction))
     .def("conjunction", &automaton_conjunction,
          (arg("automata"), arg("lazy") = false))
         .staticmethod("conjunction")
@@ -358,34 +492,39 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def("context", &automaton::context)
     .def("costandard", &automaton::costandard)
     .def("delay_automaton", &automaton::delay_automaton)
-    .def("determinize", &automaton::determinize, (arg("algo") = "auto"))
-    .def("difference", &automaton::difference)
+    .def("determinize", NOGIL(automaton::determinize), (arg("algo") = "auto"))
+    .def("difference", NOGIL(automaton::difference))
     .def("eliminate_state", &automaton::eliminate_state, (arg("state") = -1))
-    .def("_evaluate", static_cast<evaluate_t>(&automaton::evaluate))
-    .def("_evaluate", static_cast<evaluate_polynomial_t>(&automaton::evaluate))
+    .def("_evaluate", NOGIL_AS(evaluate_t, automaton::evaluate))
+    .def("_evaluate", NOGIL_AS(evaluate_polynomial_t, automaton::evaluate))
+    .def("evaluate_batch", &automaton_evaluate_batch,
+         (arg("words"), arg("num_threads") = 1))
     .def("factor", &automaton::factor)
     .def("filter", &automaton_filter)
+    .def("fingerprint", &automaton::fingerprint)
     .def("_format", &format<automaton>)
-    .def("has_bounded_lag", &automaton::has_bounded_lag)
+    .def("_format_bytes", &format_bytes<automaton>)
+    .def("freeze", &automaton::freeze)
+    .def("has_bounded_lag", NOGIL(automaton::has_bounded_lag))
     .def("has_lightening_cycle", &automaton::has_lightening_cycle)
-    .def("has_twins_property", &automaton::has_twins_property)
+    .def("has_twins_property", NOGIL(automaton::has_twins_property))
     .def("_infiltrate", &automaton_infiltrate).staticmethod("_infiltrate")
     .def("insplit", &automaton::insplit, (arg("lazy") = false))
     .def("is_accessible", &automaton::is_accessible)
-    .def("is_ambiguous", &automaton::is_ambiguous)
+    .def("is_ambiguous", NOGIL(automaton::is_ambiguous))
     .def("is_coaccessible", &automaton::is_coaccessible)
     .def("is_codeterministic", &automaton::is_codeterministic)
     .def("is_complete", &automaton::is_complete)
     .def("is_costandard", &automaton::is_costandard)
-    .def("is_cycle_ambiguous", &automaton::is_cycle_ambiguous)
+    .def("is_cycle_ambiguous", NOGIL(automaton::is_cycle_ambiguous))
     .def("is_deterministic", &automaton::is_deterministic)
     .def("is_empty", &automaton::is_empty)
     .def("is_eps_acyclic", &automaton::is_eps_acyclic)
-    .def("is_equivalent", &automaton::is_equivalent)
-    .def("is_functional", &automaton::is_functional)
+    .def("is_equivalent", NOGIL(automaton::is_equivalent))
+    .def("is_functional", NOGIL(automaton::is_functional))
     .def("is_letterized", &automaton::is_letterized)
     .def("is_partial_identity", &automaton::is_partial_identity)
-    .def("is_isomorphic", &automaton::is_isomorphic)
+    .def("is_isomorphic", NOGIL(automaton::is_isomorphic))
     .def("is_normalized", &automaton::is_normalized)
     .def("is_proper", &automaton::is_proper)
     .def("is_out_sorted", &automaton::is_out_sorted)
@@ -393,7 +532,7 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def("is_standard", &automaton::is_standard)
     .def("is_synchronized", &automaton::is_synchronized)
     .def("_is_synchronized_by", &automaton::is_synchronized_by)
-    .def("is_synchronizing", &automaton::is_synchronizing)
+    .def("is_synchronizing", NOGIL(automaton::is_synchronizing))
     .def("is_trim", &automaton::is_trim)
     .def("is_useless", &automaton::is_useless)
     .def("is_valid", &automaton::is_valid)
@@ -404,16 +543,16 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def("letterize", &automaton::letterize)
     .def("_lift", &automaton_lift)
     .def("_lift", &automaton::lift)
-    .def("lightest", &automaton::lightest,
+    .def("lightest", NOGIL(automaton::lightest),
          (arg("num") = 1U, arg("algo") = "auto"))
     .def("lightest_automaton",
-         &automaton::lightest_automaton,
+         NOGIL(automaton::lightest_automaton),
          (arg("num") = 1U, arg("algo") = "auto"))
-    .def("minimize", &automaton::minimize, (arg("algo") = "auto"))
-    .def("multiply", static_cast<automaton_multiply_t>(&automaton::multiply),
+    .def("minimize", NOGIL(automaton::minimize), (arg("algo") = "auto"))
+    .def("multiply", NOGIL_AS(automaton_multiply_t, automaton::multiply),
          (arg("algo") = "auto"))
     .def("multiply",
-         static_cast<automaton_multiply_repeated_t>(&automaton::multiply),
+         NOGIL_AS(automaton_multiply_repeated_t, automaton::multiply),
          (arg("min"), arg("max") = -2, arg("algo") = "auto"))
     .def("normalize", &automaton::normalize)
     .def("num_components", &automaton::num_components)
@@ -421,7 +560,7 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def("prefix", &automaton::prefix)
     .def("partial_identity", &automaton::partial_identity)
     .def("project", &automaton::project)
-    .def("proper", &automaton::proper,
+    .def("proper", NOGIL(automaton::proper),
          (arg("direction") = "backward", arg("prune") = true,
           arg("algo") = "auto"))
     .def("push_weights", &automaton::push_weights)
@@ -429,11 +568,11 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def("expression", &automaton_expression,
          (arg("identities") = "default", arg("algo") = "auto"))
     .def("rdivide", &automaton::rdivide)
-    .def("reduce", &automaton::reduce)
+    .def("reduce", NOGIL(automaton::reduce))
     .def("rweight", &automaton::rweight,
          (arg("weight"), arg("algo") = "auto"))
-    .def("scc", &automaton::scc, (arg("algo") = "auto"))
-    .def("shortest", &automaton::shortest,
+    .def("scc", NOGIL(automaton::scc), (arg("algo") = "auto"))
+    .def("shortest", NOGIL(automaton::shortest),
          (arg("num") = boost::optional<unsigned>(),
           arg("len") = boost::optional<unsigned>()))
     .def("_shuffle", &automaton_shuffle).staticmethod("_shuffle")
@@ -443,9 +582,9 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def("strip", &automaton::strip)
     .def("suffix", &automaton::suffix)
     .def("subword", &automaton::subword)
-    .def("synchronize", &automaton::synchronize)
+    .def("synchronize", NOGIL(automaton::synchronize))
     .def("synchronizing_word",
-         &automaton::synchronizing_word, (arg("algo") = "greedy"))
+         NOGIL(automaton::synchronizing_word), (arg("algo") = "greedy"))
     .def("transpose", &automaton::transpose)
     .def("trim", &automaton::trim)
     .def("_tuple", &automaton_tuple).staticmethod("_tuple")
@@ -516,7 +655,8 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def(bp::init<const context&, const std::string&, const std::string&>
          ((arg("context"), arg("data"), arg("identities") = "default")))
     // `expression.automaton` is redefined to be a native Python function
-    .def("_automaton", &expression::to_automaton, (arg("algo") = "auto"))
+    .def("_automaton", NOGIL(expression::to_automaton),
+         (arg("algo") = "auto"))
     .def("add", &expression::add)
     .def("compare", &expression::compare)
     .def("complement", &expression::complement)
@@ -526,7 +666,8 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def("context", &expression::context)
     .def("_derivation", &expression::derivation,
          (arg("label"), arg("breaking") = false))
-    .def("derived_term", &expression::derived_term, (arg("algo") = "auto"))
+    .def("derived_term", NOGIL(expression::derived_term),
+         (arg("algo") = "auto"))
     .def("difference", &expression::difference)
     .def("expand", &expression::expand)
     .def("expansion", &expression::to_expansion)
@@ -534,14 +675,15 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
          (arg("context") = context(), arg("identities") = "default"))
     .def("format", &format<expression>)
     .def("identities", &expression::identities_of)
-    .def("inductive", &expression::inductive, (arg("algo") = "auto"))
+    .def("inductive", NOGIL(expression::inductive), (arg("algo") = "auto"))
     .def("infiltrate", &expression::infiltrate)
-    .def("is_equivalent", &expression::is_equivalent)
+    .def("is_equivalent", NOGIL(expression::is_equivalent))
     .def("is_valid", &expression::is_valid)
     .def("ldivide", &expression::ldivide)
     .def("lweight", &expression::lweight)
     .def("less_than", &expression::less_than)
     .def("lift", &expression::lift)
+    .def("_match", NOGIL(expression::match))
     .def("multiply", static_cast<multiply_t<expression>>(&expression::multiply))
     .def("multiply",
          static_cast<multiply_repeated_t<expression>>(&expression::multiply),
@@ -551,16 +693,17 @@ BOOST_PYTHON_MODULE(vcsn_cxx)
     .def("project", &expression::project)
     .def("rdivide", &expression::rdivide)
     .def("rweight", &expression::rweight)
+    .def("_search", &expression_search)
     .def("shuffle", &expression::shuffle)
     .def("split", &expression::split)
-    .def("standard", &expression::standard)
+    .def("standard", NOGIL(expression::standard))
     .def("star_height", &expression::star_height)
     .def("star_normal_form", &expression::star_normal_form)
-    .def("thompson", &expression::thompson)
+    .def("thompson", NOGIL(expression::thompson))
     .def("transpose", &expression::transpose)
     .def("transposition", &expression::transposition)
     .def("_tuple", &expression_tuple).staticmethod("_tuple")
-    .def("zpc", &expression::zpc, (arg("algo") = "auto"))
+    .def("zpc", NOGIL(expression::zpc), (arg("algo") = "auto"))
     ;
 
   bp::class_<label>("label", bp::no_init)
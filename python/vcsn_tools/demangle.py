@@ -82,6 +82,7 @@ def sugar(s: str) -> str:
     s = sub(r'(\w+)_automaton', r'\1', s)
     s = sub(r'nullableset<{param}>', r'(\1)?', s)
     s = sub(r'letterset<{param}>', r'\1', s)
+    s = sub(r'interned_wordset<{param}>', r'(\1)*', s)
     s = sub(r'wordset<{param}>', r'(\1)*', s)
     s = sub(r'context<{param},\s*{param}>', r'\1 → \2', s)
     s = sub(r'^context<(.*)>$', r'\1', s)
@@ -93,7 +94,7 @@ def sugar(s: str) -> str:
 def pretty_plugin(filename: str):
     '''Split compilation type with its arguments and add sugar to the message.'''
     # what = algos|contexts, specs = argument specifications.
-    m = re.match(r'.*/plugins/([^/]+)/(.*)', filename)
+    m = re.match(r'.*/plugins/(?:[0-9a-f]{16}/)?([^/]+)/(.*)', filename)
     if m:
         what, specs = m.group(1, 2)
         if what == 'algos':
@@ -243,6 +244,9 @@ def demangle(s: str, color: str="auto") -> str:
     s = sub(r'(?:vcsn::)?letterset<(?:vcsn::)?set_alphabet<(?:vcsn::)?(\w+)_letters> >',
             r'lal_\1',
             s)
+    s = sub(r'(?:vcsn::)?interned_wordset<(?:vcsn::)?set_alphabet<(?:vcsn::)?(\w+)_letters> >',
+            r'lawi_\1',
+            s)
     s = sub(r'(?:vcsn::)?wordset<(?:vcsn::)?set_alphabet<(?:vcsn::)?(\w+)_letters> >',
             r'law_\1',
             s)
@@ -0,0 +1,400 @@
+// Benchmarks of the main algorithm families, on the static API (no
+// dyn:: dispatch, no Python).  Run `make bench` to run them all and
+// save the results in JSON, which `vcsn score-compare` can compare.
+//
+// $ VCSN_SEED=1 ./tests/benchmarks/algos --benchmark_filter=minimize
+//
+// Inputs are built by the usual generators: de_bruijn, ladybird,
+// divkbaseb, cerny, random_automaton.  Random automata are
+// reproducible when VCSN_SEED is set.
+
+#include <benchmark/benchmark.h>
+
+#include <vcsn/alphabets/char.hh>
+#include <vcsn/alphabets/setalpha.hh>
+#include <vcsn/labelset/letterset.hh>
+#include <vcsn/labelset/nullableset.hh>
+#include <vcsn/labelset/tupleset.hh>
+#include <vcsn/weightset/b.hh>
+#include <vcsn/weightset/nmin.hh>
+#include <vcsn/weightset/qh.hh>
+#include <vcsn/weightset/qmp.hh>
+#include <vcsn/weightset/r.hh>
+#include <vcsn/weightset/z.hh>
+
+#include <vcsn/algos/accessible.hh>
+#include <vcsn/algos/cerny.hh>
+#include <vcsn/algos/compose.hh>
+#include <vcsn/algos/conjunction.hh>
+#include <vcsn/algos/de-bruijn.hh>
+#include <vcsn/algos/derived-term.hh>
+#include <vcsn/algos/determinize.hh>
+#include <vcsn/algos/divkbaseb.hh>
+#include <vcsn/algos/ladybird.hh>
+#include <vcsn/algos/lightest-path.hh>
+#include <vcsn/algos/lightest.hh>
+#include <vcsn/algos/minimize.hh>
+#include <vcsn/algos/proper.hh>
+#include <vcsn/algos/random-automaton.hh>
+#include <vcsn/algos/reduce.hh>
+#include <vcsn/algos/shortest.hh>
+#include <vcsn/core/rat/expressionset.hh>
+
+namespace
+{
+  using namespace vcsn;
+
+  using ls_t = letterset<set_alphabet<char_letters>>;
+  using lan_t = nullableset<ls_t>;
+  using lat_t = tupleset<ls_t, ls_t>;
+
+  /// The context `lal(abc), WeightSet`.
+  template <typename WeightSet = b>
+  context<ls_t, WeightSet> ctx_abc()
+  {
+    return {ls_t{'a', 'b', 'c'}, WeightSet{}};
+  }
+
+  /// The trim part of a random complete deterministic automaton with
+  /// \a n states, a quarter of which are final.
+  template <typename Ctx>
+  auto random_dfa(const Ctx& ctx, unsigned n)
+  {
+    auto res = random_automaton_deterministic(ctx, n);
+    for (auto s: res->states())
+      if (s % 4 == 0)
+        res->set_final(s);
+    return trim(res);
+  }
+
+  /// Check that an input automaton is not empty.
+  template <Automaton Aut>
+  const Aut& nonempty(const Aut& aut)
+  {
+    if (!aut->num_states())
+      std::abort();
+    return aut;
+  }
+}
+
+/*--------------.
+| determinize.  |
+`--------------*/
+
+// ladybird(n) determinizes into 2^n states.
+static void BM_determinize_ladybird(benchmark::State& state)
+{
+  const auto aut = nonempty(ladybird(ctx_abc(), state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(determinize(aut));
+  state.SetLabel("ladybird(" + std::to_string(state.range(0)) + ')');
+}
+BENCHMARK(BM_determinize_ladybird)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(8)->Arg(12)->Arg(16);
+
+// de_bruijn(n) determinizes into 2^(n+1) states.
+static void BM_determinize_de_bruijn(benchmark::State& state)
+{
+  const auto aut = nonempty(de_bruijn(context<ls_t, b>{ls_t{'a', 'b'}, {}},
+                                      state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(determinize(aut));
+  state.SetLabel("de_bruijn(" + std::to_string(state.range(0)) + ')');
+}
+BENCHMARK(BM_determinize_de_bruijn)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(8)->Arg(12)->Arg(14);
+
+// The parallel determinization of de_bruijn(n).  Second argument:
+// the number of threads.
+static void BM_determinize_parallel(benchmark::State& state)
+{
+  const auto aut = nonempty(de_bruijn(context<ls_t, b>{ls_t{'a', 'b'}, {}},
+                                      state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(determinize_parallel(aut, state.range(1)));
+  state.SetLabel("de_bruijn(" + std::to_string(state.range(0)) + ')');
+}
+BENCHMARK(BM_determinize_parallel)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({14, 1})
+  ->Args({14, 2})
+  ->Args({14, 4})
+  ->Args({16, 1})
+  ->Args({16, 4});
+
+/*-----------.
+| minimize.  |
+`-----------*/
+
+// A random deterministic automaton, minimized by the algorithm
+// selected by Tag.
+template <typename Tag>
+static void BM_minimize(benchmark::State& state)
+{
+  const auto aut = nonempty(random_dfa(ctx_abc(), state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(minimize(aut, Tag{}));
+  state.SetLabel("random_deterministic("
+                 + std::to_string(state.range(0)) + ')');
+}
+BENCHMARK_TEMPLATE(BM_minimize, vcsn::moore_tag)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_minimize, vcsn::signature_tag)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_minimize, vcsn::signature_parallel_tag)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_minimize, vcsn::hopcroft_tag)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_minimize, vcsn::weighted_tag)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(1000)->Arg(10000);
+
+// The weighted minimization of the Cerny automaton, seen as a
+// Z-automaton.
+static void BM_minimize_cerny_z(benchmark::State& state)
+{
+  const auto aut = nonempty(cerny(context<ls_t, z>{ls_t{'a', 'b'}, {}},
+                                  state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(minimize(aut, weighted_tag{}));
+  state.SetLabel("cerny(" + std::to_string(state.range(0)) + ')');
+}
+BENCHMARK(BM_minimize_cerny_z)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(100)->Arg(1000);
+
+/*---------.
+| proper.  |
+`---------*/
+
+// A random automaton where about half of the transitions are
+// spontaneous.
+static void BM_proper(benchmark::State& state)
+{
+  const auto ctx = context<lan_t, b>{lan_t{ls_t{'a', 'b', 'c'}}, {}};
+  const auto aut = nonempty(random_automaton(ctx, state.range(0), 0.01));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(proper(aut));
+  state.SetLabel("random(" + std::to_string(state.range(0)) + ')');
+}
+BENCHMARK(BM_proper)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(100)->Arg(200);
+
+/*--------------.
+| conjunction.  |
+`--------------*/
+
+// The product of divkbaseb(n, 2) and divkbaseb(n+1, 2) has n(n+1)
+// states.
+static void BM_conjunction(benchmark::State& state)
+{
+  const auto ctx = context<ls_t, b>{ls_t{'0', '1'}, {}};
+  const auto n = state.range(0);
+  const auto lhs = nonempty(divkbaseb(ctx, n, 2));
+  const auto rhs = nonempty(divkbaseb(ctx, n + 1, 2));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(conjunction(lhs, rhs));
+  state.SetLabel("divkbaseb(" + std::to_string(n) + ", 2)");
+}
+BENCHMARK(BM_conjunction)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(100)->Arg(300);
+
+// The product of the Z-weighted de Bruijn and ladybird automata.
+static void BM_conjunction_z(benchmark::State& state)
+{
+  const auto ctx = ctx_abc<z>();
+  const auto lhs = nonempty(de_bruijn(ctx, state.range(0)));
+  const auto rhs = nonempty(ladybird(ctx, state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(conjunction(lhs, rhs));
+  state.SetLabel("de_bruijn(" + std::to_string(state.range(0)) + ')');
+}
+BENCHMARK(BM_conjunction_z)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(100)->Arg(300);
+
+// The product of three de Bruijn automata.
+static void BM_conjunction_variadic(benchmark::State& state)
+{
+  const auto ctx = ctx_abc<b>();
+  const auto aut = nonempty(de_bruijn(ctx, state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(conjunction(aut, aut, aut));
+  state.SetLabel("de_bruijn(" + std::to_string(state.range(0)) + ")^3");
+}
+BENCHMARK(BM_conjunction_variadic)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(20)->Arg(40);
+
+/*----------.
+| compose.  |
+`----------*/
+
+// The composition of a random transducer with itself.
+static void BM_compose(benchmark::State& state)
+{
+  const auto ls = ls_t{'a', 'b', 'c'};
+  const auto ctx = context<lat_t, b>{lat_t{ls, ls}, {}};
+  const auto aut = nonempty(random_automaton(ctx, state.range(0), 0.1));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(compose(aut, aut));
+  state.SetLabel("random(" + std::to_string(state.range(0)) + ')');
+}
+BENCHMARK(BM_compose)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(20)->Arg(50);
+
+// The parallel composition of a random transducer with itself.
+// Second argument: the number of threads.
+static void BM_compose_parallel(benchmark::State& state)
+{
+  const auto ls = ls_t{'a', 'b', 'c'};
+  const auto ctx = context<lat_t, b>{lat_t{ls, ls}, {}};
+  const auto aut = nonempty(random_automaton(ctx, state.range(0), 0.1));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(compose_parallel(aut, aut, state.range(1)));
+  state.SetLabel("random(" + std::to_string(state.range(0)) + ')');
+}
+BENCHMARK(BM_compose_parallel)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({50, 1})
+  ->Args({50, 4});
+
+/*---------------------.
+| shortest, lightest.  |
+`---------------------*/
+
+// The first words accepted by the Z-weighted ladybird.
+static void BM_shortest(benchmark::State& state)
+{
+  const auto aut = nonempty(ladybird(ctx_abc<z>(), state.range(0)));
+  const auto num = unsigned(state.range(1));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(shortest(aut, num));
+  state.SetLabel("ladybird(" + std::to_string(state.range(0)) + ')');
+}
+BENCHMARK(BM_shortest)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({100, 100})
+  ->Args({100, 1000});
+
+// The lightest path in a random automaton with weights in nmin,
+// computed by the algorithm selected by Tag.
+template <typename Tag>
+static void BM_lightest_path(benchmark::State& state)
+{
+  const auto aut
+    = nonempty(random_automaton(ctx_abc<nmin>(), state.range(0), 0.01,
+                                1, 1, {}, 0.0, "min=1, max=20"));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(lightest_path(aut, Tag{}));
+  state.SetLabel("random(" + std::to_string(state.range(0)) + ')');
+}
+BENCHMARK_TEMPLATE(BM_lightest_path, vcsn::dijkstra_tag)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_lightest_path, vcsn::dial_tag)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_lightest_path, vcsn::radix_heap_tag)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_lightest_path, vcsn::bellman_ford_tag)
+  ->Unit(benchmark::kMillisecond)
+  ->Arg(1000)->Arg(3000);
+
+// The k lightest words of a random automaton with weights in nmin.
+static void BM_lightest(benchmark::State& state)
+{
+  const auto aut
+    = nonempty(random_automaton(ctx_abc<nmin>(), state.range(0), 0.01,
+                                1, 1, {}, 0.0, "min=1, max=20"));
+  const auto num = unsigned(state.range(1));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(lightest(aut, num));
+  state.SetLabel("random(" + std::to_string(state.range(0)) + ')');
+}
+BENCHMARK(BM_lightest)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({1000, 1})
+  ->Args({1000, 10});
+
+/*---------------.
+| derived_term.  |
+`---------------*/
+
+// The derived-term automaton of `(a+b)*a(a+b){n}`.  Second argument:
+// 0 for "expansion", 1 for "derivation".  Third argument: whether to
+// allocate the expressions in an arena.
+static void BM_derived_term(benchmark::State& state)
+{
+  using ctx_t = context<ls_t, z>;
+  auto rs = expressionset<ctx_t>{ctx_t{ls_t{'a', 'b'}, {}},
+                                 rat::identities::associative};
+  rs.set_arena(state.range(2));
+  const auto apb = [&rs] { return rs.add(rs.atom('a'), rs.atom('b')); };
+  auto e = rs.mul(rs.star(apb()), rs.atom('a'));
+  for (int i = 0; i < state.range(0); ++i)
+    e = rs.mul(e, apb());
+  const auto algo = state.range(1) ? "derivation" : "expansion";
+  for (auto _ : state)
+    benchmark::DoNotOptimize(derived_term(rs, e, algo));
+  state.SetLabel(std::string(algo)
+                 + (state.range(2) ? ", arena" : "")
+                 + ": (a+b)*a(a+b){" + std::to_string(state.range(0)) + '}');
+}
+BENCHMARK(BM_derived_term)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({50, 0, 0})
+  ->Args({50, 1, 0})
+  ->Args({150, 0, 0})
+  ->Args({150, 0, 1})
+  ->Args({150, 1, 0})
+  ->Args({150, 1, 1});
+
+/*---------.
+| reduce.  |
+`---------*/
+
+// The reduction of a random Q-automaton.  Use qmp or qh: random
+// weights quickly overflow q.  Second argument: the number of
+// threads.
+template <typename WeightSet>
+static void BM_reduce(benchmark::State& state)
+{
+  const auto aut
+    = nonempty(random_automaton(ctx_abc<WeightSet>(), state.range(0), 0.1,
+                                1, 1, {}, 0.0, "min=1, max=5"));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(reduce(aut, state.range(1)));
+  state.SetLabel("random(" + std::to_string(state.range(0)) + ')');
+}
+BENCHMARK_TEMPLATE(BM_reduce, vcsn::qmp)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({20, 1})
+  ->Args({50, 1})
+  ->Args({80, 1})
+  ->Args({80, 0});
+BENCHMARK_TEMPLATE(BM_reduce, vcsn::qh)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({20, 1})
+  ->Args({50, 1})
+  ->Args({80, 1})
+  ->Args({80, 0});
+BENCHMARK_TEMPLATE(BM_reduce, vcsn::r)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({200, 1})
+  ->Args({500, 1})
+  ->Args({500, 0});
+
+BENCHMARK_MAIN();
+
+// CXXFLAGS: -lbenchmark
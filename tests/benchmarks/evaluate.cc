@@ -24,6 +24,7 @@
 #include <vcsn/alphabets/char.hh>
 #include <vcsn/labelset/letterset.hh>
 #include <vcsn/weightset/b.hh>
+#include <vcsn/weightset/z.hh>
 
 #include <vcsn/algos/de-bruijn.hh>
 #include <vcsn/algos/evaluate.hh>
@@ -50,6 +51,122 @@ BENCHMARK(BM_evaluate)
     ->Args({5000})
     ->Args({10000});
 
+// The general evaluator, built once, used many times.
+static void BM_evaluate_generic(benchmark::State& state)
+{
+  using namespace vcsn;
+
+  using ls_t = letterset<set_alphabet<char_letters>>;
+  using ws_t = b;
+  const auto ctx = context<ls_t, ws_t>{{{'a', 'b', 'c'}}, {}};
+  const auto aut = vcsn::de_bruijn(ctx, state.range(0));
+  const auto word = std::string(state.range(0) + 1, 'a');
+  const auto eval = detail::evaluator<decltype(aut)>{aut};
+
+  if (!eval(word))
+    std::abort();
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(eval(word));
+}
+BENCHMARK(BM_evaluate_generic)
+    ->Args({1000})
+    ->Args({2000})
+    ->Args({5000})
+    ->Args({10000});
+
+// The Boolean engine, compiled once, used many times.
+static void BM_evaluate_bool(benchmark::State& state)
+{
+  using namespace vcsn;
+
+  using ls_t = letterset<set_alphabet<char_letters>>;
+  using ws_t = b;
+  const auto ctx = context<ls_t, ws_t>{{{'a', 'b', 'c'}}, {}};
+  const auto aut = vcsn::de_bruijn(ctx, state.range(0));
+  const auto word = std::string(state.range(0) + 1, 'a');
+  const auto eval = detail::bool_evaluator<decltype(aut)>{aut};
+
+  if (!eval(word))
+    std::abort();
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(eval(word));
+}
+BENCHMARK(BM_evaluate_bool)
+    ->Args({1000})
+    ->Args({2000})
+    ->Args({5000})
+    ->Args({10000});
+
+// A de Bruijn automaton on 26 letters: every state has (at least)
+// 26 outgoing transitions.  Second argument: whether to enable the
+// label index.
+static void BM_evaluate_26(benchmark::State& state)
+{
+  using namespace vcsn;
+
+  using ls_t = letterset<set_alphabet<char_letters>>;
+  using ws_t = b;
+  const auto ctx = context<ls_t, ws_t>{{{'a', 'b', 'c', 'd', 'e', 'f', 'g',
+                                         'h', 'i', 'j', 'k', 'l', 'm', 'n',
+                                         'o', 'p', 'q', 'r', 's', 't', 'u',
+                                         'v', 'w', 'x', 'y', 'z'}}, {}};
+  const auto aut = vcsn::de_bruijn(ctx, state.range(0));
+  aut->set_label_index(state.range(1));
+  const auto word = std::string(state.range(0) + 1, 'a');
+
+  if (!vcsn::evaluate(aut, word))
+    std::abort();
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(vcsn::evaluate(aut, word));
+}
+BENCHMARK(BM_evaluate_26)
+    ->Args({1000, false})
+    ->Args({1000, true})
+    ->Args({2000, false})
+    ->Args({2000, true});
+
+// All the words of length 10 on {a, b, c}, evaluated on a Z de
+// Bruijn automaton.  Second argument: 0 to evaluate the words one by
+// one, otherwise the number of threads given to evaluate_batch.
+static void BM_evaluate_batch(benchmark::State& state)
+{
+  using namespace vcsn;
+
+  using ls_t = letterset<set_alphabet<char_letters>>;
+  using ws_t = z;
+  const auto ctx = context<ls_t, ws_t>{{{'a', 'b', 'c'}}, {}};
+  const auto aut = vcsn::de_bruijn(ctx, state.range(0));
+  auto words = std::vector<std::string>{""};
+  for (int i = 0; i < 10; ++i)
+    {
+      auto ws = std::vector<std::string>{};
+      for (const auto& w: words)
+        for (auto l: {'a', 'b', 'c'})
+          ws.emplace_back(w + l);
+      words = std::move(ws);
+    }
+  // Don't feed them sorted.
+  std::reverse(begin(words), end(words));
+  const auto threads = state.range(1);
+
+  for (auto _ : state)
+    if (threads)
+      benchmark::DoNotOptimize(vcsn::evaluate_batch(aut, words, threads));
+    else
+      for (const auto& w: words)
+        benchmark::DoNotOptimize(vcsn::evaluate(aut, w));
+}
+BENCHMARK(BM_evaluate_batch)
+    ->Args({10, 0})
+    ->Args({10, 1})
+    ->Args({10, 2})
+    ->Args({100, 0})
+    ->Args({100, 1})
+    ->Args({100, 2});
+
 BENCHMARK_MAIN();
 
 // CXXFLAGS: -lbenchmark
@@ -0,0 +1,49 @@
+## Vcsn, a generic library for finite state machines.
+## Copyright (C) 2018 Vcsn Group.
+##
+## This program is free software; you can redistribute it and/or
+## modify it under the terms of the GNU General Public License
+## as published by the Free Software Foundation; either version 2
+## of the License, or (at your option) any later version.
+##
+## The complete GNU General Public Licence Notice can be found as the
+## `COPYING' file in the root directory.
+##
+## The Vcsn Group consists of people listed in the `AUTHORS' file.
+
+# Compiled only by `make bench`.
+%C%_benchmarks =                                \
+  %D%/algos                                     \
+  %D%/evaluate                                  \
+  %D%/letters-of
+
+EXTRA_PROGRAMS += $(%C%_benchmarks)
+EXTRA_DIST += %D%/README.md
+
+bench_ldadd = $(libvcsn) $(BENCHMARK_LIBS) $(RT_LIBS)
+
+%C%_algos_LDADD      = $(bench_ldadd)
+%C%_evaluate_LDADD   = $(bench_ldadd)
+%C%_letters_of_LDADD = $(bench_ldadd)
+
+# Where to save the results, as JSON: DIR/NAME.json.  Compare two
+# runs with `vcsn score-compare OLD/algos.json NEW/algos.json`.
+BENCH_DIR = %D%
+# Flags passed to the benchmarks, e.g.,
+# `make bench BENCHFLAGS=--benchmark_filter=minimize`.
+BENCHFLAGS =
+
+.PHONY: bench
+bench: $(%C%_benchmarks)
+	@test -n '$(BENCHMARK_LIBS)' || {				\
+	  echo >&2 'bench: Google Benchmark was not found by configure';	\
+	  exit 1;							\
+	}
+	$(MKDIR_P) $(BENCH_DIR)
+	@set -e;							\
+	for b in $(%C%_benchmarks); do					\
+	  echo "bench: $$b";						\
+	  VCSN_SEED=1 ./$$b						\
+	    --benchmark_out=$(BENCH_DIR)/$$(basename $$b).json		\
+	    --benchmark_out_format=json $(BENCHFLAGS);			\
+	done
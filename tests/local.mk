@@ -39,6 +39,7 @@ include %D%/demo/local.mk
 include %D%/python/local.mk
 include %D%/rat/local.mk
 include %D%/tools/local.mk
+include %D%/benchmarks/local.mk
 
 TEST_SUITE_LOG = %D%/test-suite.log
 AM_RST2HTMLFLAGS = -d -t
@@ -571,6 +571,24 @@ for fn in glob.glob(os.path.join(medir, '*.in.gv')):
     CHECK_EQ(a, vcsn.automaton(ref))
 
 
+# Duplicate transitions are merged, and dropped when their weights
+# cancel.
+CHECK_EQ('''context = letterset<char_letters(ab)>, z
+$ -> 0
+0 -> 1 <3>a
+1 -> $ <3>''',
+         vcsn.automaton('''
+context = lal(ab), z
+$ -> 0
+0 -> 1 a
+0 -> 1 <2>a
+0 -> 1 b
+0 -> 1 <-1>b
+1 -> $
+1 -> $ <2>
+''').format('daut'))
+
+
 # A daut file whose names have quotes: beware of building "Ifoo" and
 # "Ffoo", not I"foo" and F"foo".
 CHECK_EQ(r'''digraph
@@ -740,6 +758,46 @@ for fn in glob.glob(os.path.join(medir, '*.grail')):
     check_grail(a)
 
 
+## ---------- ##
+## I/O: vbin. ##
+## ---------- ##
+
+def check_vbin(aut):
+    '''Check that aut survives a round-trip through vbin, from bytes and
+    from a (mapped) file.'''
+    data = aut.format('vbin')
+    CHECK(isinstance(data, bytes))
+    res = vcsn.automaton(data, 'vbin')
+    CHECK_ISOMORPHIC(aut, res)
+    # The states are numbered densely, so a second round-trip is exact.
+    CHECK_EQ(data, res.format('vbin'))
+    name = "automaton.vbin"
+    with open(name, 'wb') as f:
+        f.write(data)
+    CHECK_EQ(res, vcsn.automaton(filename=name, format='vbin'))
+    CHECK_EQ(res, vcsn.automaton(filename=name))
+    os.remove(name)
+
+for fn in glob.glob(os.path.join(medir, '*.fado')):
+    check_vbin(vcsn.automaton(filename=fn.replace('.fado', '.gv')))
+
+for ctx, exp in [('lal_char(ab), b', '(a+b)*b'),
+                 ('lan_char(abc), q', '<1/2>a*+<-3>(bc)*'),
+                 ('law_char, zmin', '<2>(ab)*<3>c'),
+                 ('lat<lal_char(ab), lan_char(xy)>, r', '<.5>(a|x)*(b|\\e)'),
+                 ('lal_char(ab), expressionset<lal_char(xy), q>',
+                  '<x*>a+<<2>y>b')]:
+    check_vbin(vcsn.context(ctx).expression(exp).standard())
+
+# Empty automaton.
+check_vbin(vcsn.context('lal_char, b').expression('\\z').standard())
+
+# Invalid contents.
+XFAIL(lambda: vcsn.automaton(b'VCSNBIN\n', 'vbin'), 'vbin: invalid header')
+data = vcsn.B.expression('ab').standard().format('vbin')
+XFAIL(lambda: vcsn.automaton(data[:-5], 'vbin'), 'vbin: truncated file')
+
+
 ## ------------ ##
 ## Conversion.  ##
 ## ------------ ##
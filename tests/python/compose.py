@@ -297,3 +297,25 @@ c2 = chien.compose(fr_to_es_lazy)
 # laziness).  This is to be fixed at some point, but in the meanwhile,
 # just be cautious about calling info.
 CHECK_EQ(fr_to_es_lazy.info('number of lazy states'), 1)
+
+
+## ---------------------- ##
+## Parallel composition.  ##
+## ---------------------- ##
+
+# The parallel exploration builds exactly the same automaton.
+CHECK_EQ(metext('result.gv'),
+         meaut('left.gv').compose(meaut('right.gv'), algo='parallel'))
+CHECK_EQ(fr_to_en.compose(en_to_es),
+         fr_to_en.compose(en_to_es, algo='parallel'))
+c = vcsn.context('lat<lal(ab), lal(ab)>, z')
+t = c.expression("(<2>(a|b)+<3>(b|a)+<-1>(a|a))*").standard()
+CHECK_EQ(t.compose(t).compose(t),
+         t.compose(t, algo='parallel').compose(t, algo='parallel'))
+# Expressions cannot be built concurrently: a single thread is used.
+c = vcsn.context('lat<lal(ab), lal(ab)>, expressionset<lal(xy), q>')
+t = c.expression("(<x>(a|b)+<y>(b|a)+<xy>(a|a))*").standard()
+CHECK_EQ(t.compose(t).compose(t),
+         t.compose(t, algo='parallel').compose(t, algo='parallel'))
+XFAIL(lambda: t.compose(t, algo='foo'),
+      'compose: invalid algorithm: "foo"')
@@ -287,6 +287,15 @@ for l in ['a', 'b', 'c', 'd']:
     a[l] = std(ctx, '<{}>x'.format(l))
 check_enumerate('<abcd>x', a['a'] & a['b'] & a['c'] & a['d'])
 
+# Automata labeled by letters have a dedicated implementation of the
+# eager conjunction: check it against the lazy one.
+ctx = vcsn.context('lal(abc), z')
+a1 = ctx.de_bruijn(2)
+a2 = ctx.ladybird(3)
+a3 = ctx.expression('(<2>a+b+<3>c)*a').standard()
+CHECK_ISOMORPHIC(a1.conjunction(a2, a3, lazy=True).accessible(),
+                 a1.conjunction(a2, a3))
+
 
 ## ------------------------- ##
 ## expression & expression.  ##
@@ -74,6 +74,8 @@ CHECK_EQ(r'''\x01 + \x02 + \x03 + \x04 + \x05 + \x06 + \x07 + \x08 + \x09 + \n +
          .shortest(len=1))
 
 check('lal_char(ab), q', 'letterset<char_letters(ab)>, q')
+check('lal_char(ab), qh', 'letterset<char_letters(ab)>, qh')
+check('lal_char(ab), zh', 'letterset<char_letters(ab)>, zh')
 
 
 ## ------------------- ##
@@ -83,6 +85,26 @@ check('lal_char(ab), q', 'letterset<char_letters(ab)>, q')
 check('wordset<string_letters>, b', 'wordset<string_letters()>, b')
 
 
+## ---------------------------- ##
+## LabelSet: interned_wordset.  ##
+## ---------------------------- ##
+
+for c in ['interned_wordset<char_letters(abc)>, b',
+          'lawi<char(abc)>, b',
+          'lawi<char_letters(abc)>, b',
+          'lawi(abc), b']:
+    check(c, 'interned_wordset<char_letters(abc)>, b')
+check('lawi(abc), b', '{abc}* -> B', 'text')
+check('lawi<string>, b', 'interned_wordset<string_letters()>, b')
+
+# Conversions to and from wordset.
+a = vcsn.context('law(abc), q').expression('(ab+<2>c)*').standard()
+ai = a.automaton(vcsn.context('lawi(abc), q'))
+CHECK_EQ('interned_wordset<char_letters(abc)>, q', ai.context().format('sname'))
+CHECK_EQ(a, ai.automaton(a.context()))
+CHECK_EQ(a.shortest(4).format('text'), ai.shortest(4).format('text'))
+
+
 ## ------------------------- ##
 ## LabelSet: expressionset.  ##
 ## ------------------------- ##
@@ -170,7 +192,10 @@ def check(c1, c2):
     CHECK_EQ(True, c2 != c1)
 check('lan(abc), b', 'lan(abcd), b')
 check('lan(abc), b', 'law(abc), b')
+check('law(abc), b', 'lawi(abc), b')
 check('lan(abc), b', 'lan(abc), q')
+check('lan(abc), z', 'lan(abc), zh')
+check('lan(abc), q', 'lan(abc), qh')
 # Regression: at some point they were considered equal, because there
 # were no difference when printed in UTF-8.  We now check the sname.
 check('lat<lan(abc)>, b', 'lan(abc), b')
@@ -23,7 +23,7 @@ def check(aut, expfile, algo="auto", deterministic=False):
     CHECK_EQ(det, det.determinize(algo))
 
     # Laziness.
-    if algo != "boolean" and not aut.is_empty():
+    if algo not in ["boolean", "parallel"] and not aut.is_empty():
         CHECK_NE(exp, aut.determinize(algo, lazy=True))
         CHECK_EQ(exp, aut.determinize(algo, lazy=True).accessible())
 
@@ -40,10 +40,12 @@ def check(aut, expfile, algo="auto", deterministic=False):
 ctx = vcsn.context('lal_char(ab), b')
 check(ctx.de_bruijn(3), 'de-bruijn-3')
 check(ctx.de_bruijn(8), 'de-bruijn-8')
+check(ctx.de_bruijn(8), 'de-bruijn-8', algo='parallel')
 
 ctx = vcsn.context('lal_char(abc), b')
 check(ctx.ladybird(4), 'ladybird-4')
 check(ctx.ladybird(8), 'ladybird-8')
+check(ctx.ladybird(8), 'ladybird-8', algo='parallel')
 
 
 ## ------------------------------- ##
@@ -71,9 +73,33 @@ for name in ['q', 'z', 'zmin']:
 
 for name in ['b', 'f2']:
     aut = meaut(name, 'gv')
-    for algo in ['auto', 'boolean', 'weighted']:
+    for algo in ['auto', 'boolean', 'parallel', 'weighted']:
         check(aut, name, algo=algo)
 
+XFAIL(lambda: meaut('q', 'gv').determinize('parallel'),
+      'determinize: cannot apply parallel determinization to weighted automata')
+
+
+## ----------------------- ##
+## Parallel determinize.  ##
+## ----------------------- ##
+
+# The parallel determinization builds exactly the same automaton as
+# the sequential one, not just an isomorphic one.
+ctx = vcsn.context('lal_char(abc), b')
+for i in range(10):
+    aut = ctx.random_automaton(30, density=.1, num_initial=2, num_final=5)
+    det = aut.determinize('boolean')
+    CHECK_EQ(det, aut.determinize('parallel'))
+    CHECK(det.is_isomorphic(aut.determinize('parallel')))
+
+# On F2, the destinations of the input states cancel each other.
+ctx = vcsn.context('lal_char(ab), f2')
+for i in range(10):
+    aut = ctx.random_automaton(10, density=.3, num_initial=3, num_final=3)
+    det = aut.determinize('boolean')
+    CHECK_EQ(det, aut.determinize('parallel'))
+
 
 ## ------------- ##
 ## Empty state.  ##
@@ -271,3 +271,39 @@ a = ctx.expression('<2>(ab(<3>cd)*(ef))<5>', 'associative').automaton()
 check(a, "<2>abcdcdef+abcdef", '210')
 check(a,"abcdef+abcdcdcdef", '300')
 check(a, "<0>abcdcdef+abcdef", '30')
+
+
+## ---------------- ##
+## evaluate_batch.  ##
+## ---------------- ##
+
+def check_batch(aut, words):
+    exp = [aut.evaluate(w) for w in words]
+    for n in [1, 2, 0]:
+        CHECK_EQ(exp, aut.evaluate_batch(words, n))
+
+words = ['', 'a', 'ab', 'aba', 'abab', 'ba', 'bab', 'ab', 'b', 'aab', 'abba']
+for c in ['lal_char(ab), b', 'lal_char(ab), z', 'lan_char(ab), z',
+          'law_char(ab), q']:
+    ctx = vcsn.context(c)
+    check_batch(ctx.expression('(a+b)*a(a+b)*b').standard(), words)
+    check_batch(ctx.de_bruijn(3), words)
+    check_batch(ctx.expression('(<2>a+<3>b)*').derived_term(), words)
+check_batch(vcsn.context('lal_char(ab), b').expression('(a+b)*a(a+b)')
+            .derived_term().determinize(), words)
+check_batch(vcsn.context('lal_char(ab), b').ladybird(4), [])
+
+# Lazy automata are not explored beyond what the words need.
+a = vcsn.context('lal_char(ab), b').expression('(a+b)*a(a+b){10}') \
+        .derived_term().determinize(lazy=True)
+check_batch(a, ['b', 'ab', 'bab'])
+CHECK_NE(0, a.info('number of lazy states'))
+
+check_batch(vcsn.context('lat<lan, lan>, zmin')
+            .expression(r'(<0>(a|a+b|b))* (<1>[^]|\e + <1>\e|[^] + <2>(a|[^a]+b|[^b])){*}')
+            .automaton(),
+            ['aba|ab', '|', 'aaa|ab', 'aba|a'])
+
+XFAIL(lambda: vcsn.context('expressionset<lal, b>, b').expression('a')
+      .automaton().evaluate_batch(['a']),
+      'evaluate_batch: unsupported labelset: RatE[{a...} -> B]')
@@ -0,0 +1,56 @@
+#! /usr/bin/env python
+
+import vcsn
+from test import *
+
+## check(AUT, WORDS)
+## -----------------
+## Check that AUT and its frozen copy agree.
+def check(a, words):
+    f = a.freeze()
+    ctx = a.context().format('sname')
+    CHECK_EQ('frozen_automaton<{}>'.format(ctx), f.info()['type'])
+    CHECK_EQ(a.info()['number of states'], f.info()['number of states'])
+    CHECK_EQ(a.info()['number of transitions'],
+             f.info()['number of transitions'])
+    CHECK(a.is_isomorphic(f))
+    for w in words:
+        CHECK_EQ(a.evaluate(w), f.evaluate(w))
+    CHECK_EQ(a.shortest(5), f.shortest(5))
+    # Algorithms building new automata from a frozen one produce
+    # mutable automata.
+    CHECK_ISOMORPHIC(a & a, f & f)
+    if ctx.startswith('letterset'):
+        CHECK_EQ(a.is_deterministic(), f.is_deterministic())
+        if ctx.endswith(', b'):
+            CHECK_ISOMORPHIC(a.determinize(), f.determinize())
+
+
+# An empty automaton.
+check(vcsn.context('lal_char(abc), b').expression(r'\z').standard(),
+      ['', 'a'])
+
+check(vcsn.context('lal_char(abc), z').ladybird(3),
+      ['', 'a', 'ab', 'abca', 'cab', 'aabbcc'])
+
+check(vcsn.context('lal_char(ab), b').de_bruijn(3),
+      ['', 'a', 'abaa', 'bbab', 'aaab'])
+
+# Spontaneous transitions and non-trivial weights.
+a = vcsn.automaton('''
+context = lan_char(ab), q
+$ -> 0 <1/2>
+0 -> 1 <2>\e, <3>a
+1 -> 1 <1/3>a, b
+1 -> 2 \e
+2 -> $ <4>
+''')
+check(a, ['', 'a', 'ab', 'abab'])
+
+# Several transitions with the same label from one state.
+a = vcsn.context('lal_char(abc), z').expression('(<2>a+<3>a+b)*c').standard()
+check(a, ['', 'c', 'ac', 'abac', 'cc'])
+
+# Lazy automata cannot be frozen.
+a = vcsn.context('lal_char(ab), b').expression('(a+b)*a(a+b)').standard()
+XFAIL(lambda: a.determinize(lazy=True).freeze(), 'freeze: lazy automaton')
@@ -44,3 +44,26 @@ check(False, a, b3)
 check(True, b1, b2)
 check(True, b1, b3)
 check(True, b2, b3)
+
+
+## ------------- ##
+## fingerprint.  ##
+## ------------- ##
+
+# Isomorphic automata have the same fingerprint, which does not depend
+# on the numbering of the states.
+def check_fingerprint(r1, r2):
+    a1 = z.expression(r1).standard()
+    a2 = z.expression(r2).standard()
+    CHECK_EQ(a1.fingerprint(), a2.fingerprint())
+    CHECK_EQ(a1.fingerprint(), a1.sort().fingerprint())
+    CHECK_EQ(a1.fingerprint(), a1.transpose().transpose().fingerprint())
+
+check_fingerprint('(ab*c)*+(c*ba)*', '(c*ba)*+(ab*c)*')
+check_fingerprint('(a+a+b+a)', '(a+a+a+b)')
+
+# Different fingerprints: not isomorphic.
+CHECK_NE(z.expression('(ab*c)*').standard().fingerprint(),
+         z.expression('(c*ba)*').standard().fingerprint())
+CHECK_NE(z.expression('<2>a').standard().fingerprint(),
+         z.expression('<3>a').standard().fingerprint())
@@ -3,7 +3,7 @@
 import vcsn
 from test import *
 
-algos = ['a-star', 'bellman-ford', 'dijkstra']
+algos = ['a-star', 'bellman-ford', 'dial', 'dijkstra', 'radix-heap']
 
 def check(re, weight, exp):
   wexp = '<{w}>({e})'.format(w=weight, e=exp)
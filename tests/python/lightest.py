@@ -4,14 +4,19 @@ import vcsn
 from test import *
 
 # The algos that can compute the (1) lightest path.
-algos = ['auto', 'a-star', 'bellman-ford', 'breadth-first', 'dijkstra', 'yen']
+algos = ['auto', 'a-star', 'bellman-ford', 'breadth-first', 'dial',
+         'dijkstra', 'radix-heap', 'yen']
+
+# The algos that require nonnegative integral weights.
+int_algos = ['dial', 'radix-heap']
 
 # The algos that can compute the k lightest paths.
 k_algos = ['auto', 'breadth-first', 'yen', 'eppstein']
 
 def check_aut(aut, re, num, exp, tests = []):
   for algo in tests if tests else algos if num == 1 else k_algos:
-      if algo != 'eppstein' or weightset_of(ctx) in ['nmin', 'rmin', 'zmin']:
+      if ((algo != 'eppstein' or weightset_of(ctx) in ['nmin', 'rmin', 'zmin'])
+          and (algo not in int_algos or weightset_of(ctx) in ['nmin', 'zmin'])):
           print(algo + ':' + re)
           p = aut.lightest(num=num, algo=algo)
           CHECK_EQ(exp, p)
@@ -69,3 +74,14 @@ for algo in algos:
     if algo not in k_algos:
         XFAIL(lambda: zero.lightest(2, algo),
               "lightest: invalid algorithm: " + algo)
+
+# Dial and the radix heap need nonnegative integral weights.
+for algo in int_algos:
+    XFAIL(lambda: zero.lightest(1, algo),
+          'lightest-path: {}: invalid weightset: Rmin'.format(algo))
+
+ctx = vcsn.context('lal_char, zmin')
+check('<4>a+(<1>a<1>b)+<1>c+<2>d', 1, '<1>c', int_algos)
+for algo in int_algos:
+    XFAIL(lambda: ctx.expression('<2>a+<-1>b').standard().lightest(1, algo),
+          'lightest-path: {}: negative weight: -1'.format(algo))
@@ -44,6 +44,7 @@ PY_LOG_COMPILER = vcsn run $(PYTHON)
   %D%/expression.py                             \
   %D%/factory.py                                \
   %D%/filter.py                                 \
+  %D%/freeze.py                                 \
   %D%/has-bounded-lag.py                        \
   %D%/has-lightening-cycle.py                   \
   %D%/has-twins-property.py                     \
@@ -64,6 +65,7 @@ PY_LOG_COMPILER = vcsn run $(PYTHON)
   %D%/lift.py                                   \
   %D%/lightest-automaton.py                     \
   %D%/lightest.py                               \
+  %D%/match.py                                  \
   %D%/minimize.py                               \
   %D%/multiply.py                               \
   %D%/name.py                                   \
@@ -90,6 +92,7 @@ PY_LOG_COMPILER = vcsn run $(PYTHON)
   %D%/synchronize.py                            \
   %D%/synchronizing-word.py                     \
   %D%/thompson.py                               \
+  %D%/threads.py                                \
   %D%/to-expansion.py                           \
   %D%/to-expression.py                          \
   %D%/tracebacks.py                             \
@@ -0,0 +1,54 @@
+#! /usr/bin/env python
+
+import vcsn
+from test import *
+
+## ------- ##
+## match.  ##
+## ------- ##
+
+# check CTX RAT WORDS
+# -------------------
+# Check that matching the WORDS against RAT gives the same weights as
+# evaluating them on its derived-term automaton.
+def check(ctx, r, words):
+    c = vcsn.context(ctx)
+    e = c.expression(r)
+    a = e.derived_term()
+    for w in words:
+        CHECK_EQ(a.evaluate(w), e.match(w))
+
+words = ['', 'a', 'b', 'ab', 'ba', 'aab', 'abab', 'bbbab', 'abaabb', 'cab']
+check('lal_char(abc), b', '(a+b)*a(a+b)', words)
+check('lal_char(abc), b', '(a+b)*a(a+b){3}', words)
+check('lal_char(abc), b', '(a+b)*a(a+b)&(a+b)*b{c}', words)
+check('lal_char(abc), b', '[^c]*b[^c]*', words)
+check('lal_char(abc), z', '(<2>a+b)*a(<-1>a+b)', words)
+check('lal_char(abc), zmin', '(<1>a+<2>b)*<3>ab*', words)
+check('lal_char(abc), q', r'(<1/2>a)*b+<1/3>\e', words)
+
+# Many states: the cache is flushed, and eventually bypassed.
+c = vcsn.context('lal_char(ab), b')
+e = c.expression('(a+b)*a(a+b){15}')
+CHECK_EQ(True, e.match('b' * 1000 + 'a' + 'b' * 15))
+CHECK_EQ(False, e.match('a' * 1000 + 'b' * 16))
+CHECK_EQ(True, e.match('ab' * 10000))
+
+XFAIL(lambda: vcsn.context('lan_char(ab), b').expression('ab').match('ab'),
+      'match: unsupported labelset')
+
+
+## -------- ##
+## search.  ##
+## -------- ##
+
+c = vcsn.context('lal_char(abc), b')
+CHECK_EQ((3, 5), c.expression('abb*').search('ccaabbbc'))
+CHECK_EQ(None, c.expression('abb*').search('ccaacb'))
+CHECK_EQ((0, 0), c.expression('a*').search('bbb'))
+CHECK_EQ((1, 5), c.expression('a(b+c)*a').search('babcaa'))
+
+# The weights are taken into account.
+z = vcsn.context('lal_char(abc), z')
+CHECK_EQ(None, z.expression('<2>ab+<-2>ab').search('abab'))
+CHECK_EQ((2, 4), z.expression('<2>ab+<-2>ac').search('ccab'))
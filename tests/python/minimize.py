@@ -4,7 +4,7 @@ import vcsn
 
 from test import *
 
-algos = ['hopcroft', 'moore', 'signature', 'weighted']
+algos = ['hopcroft', 'moore', 'signature', 'signature,parallel', 'weighted']
 
 def check(algo, aut, exp):
     if isinstance(algo, list):
@@ -50,6 +50,7 @@ a = meaut('incomplete-non-trim.gv')
 #xfail('brzozowski', a)
 xfail('moore',      a)
 xfail('signature',  a)
+xfail('signature,parallel', a)
 xfail('weighted',   a)
 
 ## An automaton equal to redundant.exp, with no initial states.  It
@@ -59,6 +60,7 @@ z = metext('no-initial-states.exp.gv')
 check('brzozowski', a, z)
 xfail('moore',      a)
 xfail('signature',  a)
+xfail('signature,parallel', a)
 xfail('weighted',   a)
 
 ## An automaton equal to redundant.exp, with no final states.  It must
@@ -67,6 +69,7 @@ a = meaut('no-final-states.gv')
 check('brzozowski', a, z)
 xfail('moore',      a)
 xfail('signature',  a)
+xfail('signature,parallel', a)
 xfail('weighted',   a)
 
 ## Non-regression testcase: ensure that moore works and produces a
@@ -89,8 +92,10 @@ a = vcsn.context('lal_char(a), b') \
         .standard()
 exp = metext('small-nfa.exp.gv')
 check('brzozowski', a, vcsn.automaton(exp))
+xfail('hopcroft',   a)
 xfail('moore',      a)
 check('signature',  a, exp)
+check('signature,parallel', a, exp)
 check('weighted',   a, exp)
 
 ## A small weighted automaton.
@@ -99,12 +104,14 @@ exp = metext('small-z.exp.gv')
 xfail('brzozowski', a)
 xfail('moore',      a)
 xfail('signature',  a)
+xfail('signature,parallel', a)
 check('weighted',   a, exp)
 
 ## Non-lal automata.
 a = vcsn.context('law_char(a-c), b').expression('abc(bc)*+acb(bc)*').standard()
 exp = metext('nonlal.exp.gv')
 check('signature', a, exp)
+check('signature,parallel', a, exp)
 check('weighted',  a, exp)
 
 ## An already-minimal automaton.  This used to fail with Moore,
@@ -127,8 +134,20 @@ a = vcsn.context('lal_char(ab), b').expression('a+ba').automaton()
 check('brzozowski', a, a)
 CHECK_ISOMORPHIC(a.minimize('moore'), a)
 CHECK_ISOMORPHIC(a.minimize('signature'), a)
+CHECK_ISOMORPHIC(a.minimize('signature,parallel'), a)
 
 ## Check minimization idempotency in the non-lal case as well.
 a = vcsn.context('law_char(ab), b').expression('ab').standard()
 CHECK_ISOMORPHIC(a.minimize('signature'), a)
+CHECK_ISOMORPHIC(a.minimize('signature,parallel'), a)
 CHECK_ISOMORPHIC(a.minimize('weighted'), a)
+
+
+## The parallel signature minimization computes the same partition as
+## the sequential one.
+ctx = vcsn.context('lal_char(abc), b')
+for i in range(10):
+    a = ctx.random_automaton(30, density=.2, num_final=5).trim()
+    CHECK_EQ(a.minimize('signature'), a.minimize('signature,parallel'))
+    d = a.determinize().strip()
+    CHECK_EQ(d.minimize('signature'), d.minimize('signature,parallel'))
@@ -89,6 +89,26 @@ check_aut('focus',
 check_aut('project',
           'mutable_automaton<letterset<char_letters(abc)>, q>')
 
+# Transitions that become identical are merged, and dropped when
+# their weights cancel.
+a = vcsn.automaton('''
+context = lat<lal(ab), lal(xy)>, z
+$ -> 0
+0 -> 1 <2>a|x, <-2>a|y, <3>b|x, b|y
+1 -> 1 a|x
+1 -> $
+''')
+CHECK_EQ('''context = letterset<char_letters(ab)>, z
+$ -> 0
+0 -> 1 <4>b
+1 -> $
+1 -> 1 a''', a.project(0).format('daut'))
+CHECK_EQ('''context = letterset<char_letters(xy)>, z
+$ -> 0
+0 -> 1 <5>x, <-1>y
+1 -> $
+1 -> 1 x''', a.project(1).format('daut'))
+
 
 ## ------------- ##
 ## expressions.  ##
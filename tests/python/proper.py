@@ -85,6 +85,18 @@ check(metext('lan-log.in.daut'), metext('lan-log.out.daut'))
 check(metext('law-b.in.gv'), metext('law-b.out.gv'))
 
 
+## -------------------------- ##
+## interned_wordset<char>, b. ##
+## -------------------------- ##
+
+# Same automata, with interned labels.
+def interned(aut):
+    return (aut.replace('law_char(ab)', 'lawi<char(ab)>')
+            .replace('wordset<char_letters(ab)>', 'lawi<char(ab)>'))
+
+check(interned(metext('law-b.in.gv')), interned(metext('law-b.out.gv')))
+
+
 ## ------------------------------------------------- ##
 ## lan_char, z: invalid \e-cycle (weight is not 0).  ##
 ## ------------------------------------------------- ##
@@ -96,7 +96,7 @@ def exp(ws):
   0 -> 0 [label = "<10>a, <5>b"]
 }'''.replace('q', ws)
 
-for ws in ['z', 'q', 'r']:
+for ws in ['z', 'q', 'qmp', 'qh', 'r']:
     ctx = vcsn.context('lal_char(abc), ' + ws)
     a = ctx.expression(r, 'associative').standard()
     check_reduce(a, exp(ws))
@@ -169,6 +169,28 @@ check_reduce(a, '''digraph
 }''')
 
 
+# QMP and QH use the same (fraction-free) elimination, hence give the
+# same results.
+e = '(<1/2>a+<2/3>b)*<3>(a+<1/5>b)*(<4>c+a){2}'
+res = {}
+for ws in ['q', 'qmp', 'qh']:
+    a = vcsn.context('lal_char(abc), ' + ws).expression(e).derived_term()
+    red = a.reduce()
+    CHECK_EQ(a.shortest(20), red.shortest(20))
+    res[ws] = red.format('daut').replace(ws, 'WS')
+CHECK_EQ(res['qmp'], res['qh'])
+
+# Z and ZH use the same elimination, hence give the same results.
+e = '(<2>a+<3>b)*<3>(a+<5>b)*(<4>c+a){2}'
+res = {}
+for ws in ['z', 'zh']:
+    a = vcsn.context('lal_char(abc), ' + ws).expression(e).derived_term()
+    red = a.reduce()
+    CHECK_EQ(a.shortest(20), red.shortest(20))
+    res[ws] = red.format('daut').replace(ws, 'WS')
+CHECK_EQ(res['z'], res['zh'])
+
+
 # Make sure decorated automata work properly.
 q = vcsn.context('lal_char(abc), q')
 r = q.expression('<2>aa+<3>ab')
@@ -4,7 +4,8 @@ import vcsn
 from test import *
 
 def check(num_sccs, a):
-    for algo in ['dijkstra', 'kosaraju', 'tarjan_iterative', 'tarjan_recursive']:
+    for algo in ['dijkstra', 'kosaraju', 'parallel', 'tarjan_iterative',
+                 'tarjan_recursive']:
         scc = a.scc(algo)
         CHECK(scc.is_isomorphic(a))
         CHECK_EQ(num_sccs, scc.num_components())
@@ -81,6 +82,20 @@ ctx = vcsn.context('lal_char(abc), b')
 a = ctx.expression('(abc)*{5}').standard()
 check(6, a)
 
+# More than 1024 states: the parallel algorithm no longer solves the
+# problem at once, it trims it, and splits it from a pivot.  Two large
+# components, and 301 trivial ones.
+a = ctx.ladybird(1500) + ctx.ladybird(1200) \
+    + ctx.expression('a{300}').standard()
+for algo in ['parallel', 'tarjan_iterative']:
+    scc = a.scc(algo)
+    CHECK_EQ(303, scc.num_components())
+    CHECK_EQ(303, scc.condense().info('number of states'))
+
+a = ctx.random_automaton(2000, density=.0005)
+CHECK_EQ(a.scc('tarjan_iterative').num_components(),
+         a.scc('parallel').num_components())
+
 # component
 a = ctx.expression('(ab)*(bc)*').standard()
 scc = a.scc('tarjan_iterative')
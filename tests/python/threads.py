@@ -0,0 +1,75 @@
+#! /usr/bin/env python
+
+from concurrent.futures import ThreadPoolExecutor
+
+import vcsn
+from test import *
+
+# The algorithms release the GIL: run them in several threads, and
+# check that the results are those of the sequential runs.
+
+# check_threads FUN ARGS
+# ----------------------
+# Check that mapping FUN on ARGS concurrently gives the same results
+# as sequentially.
+def check_threads(fun, args):
+    exp = [fun(a) for a in args]
+    with ThreadPoolExecutor(max_workers=4) as pool:
+        eff = list(pool.map(fun, args))
+    for e, f in zip(exp, eff):
+        CHECK_EQ(e, f)
+
+
+## ------------- ##
+## Automata.     ##
+## ------------- ##
+
+auts = [vcsn.B.expression('(a+b)*a(a+b){{{}}}'.format(n)).standard()
+        for n in range(2, 10)]
+
+check_threads(lambda a: a.determinize().strip(), auts)
+check_threads(lambda a: a.minimize().strip(), auts)
+check_threads(lambda a: a.shortest(5), auts)
+check_threads(lambda a: a.evaluate('ab' * 10), auts)
+check_threads(lambda a: (a & a).strip(), auts)
+
+# Lazy automata are completed by the algorithms that read them: they
+# must not run concurrently on the same automaton.
+def lazy_det():
+    return vcsn.B.expression('(a+b)*a(a+b){10}').standard() \
+               .determinize(lazy=True)
+words = ['{:020b}'.format(n * 7919 % 2**20).replace('0', 'a').replace('1', 'b')
+         for n in range(64)]
+exp = [lazy_det().evaluate(w) for w in words]
+d = lazy_det()
+with ThreadPoolExecutor(max_workers=4) as pool:
+    eff = list(pool.map(d.evaluate, words))
+CHECK_EQ(exp, eff)
+CHECK_NE(0, d.info('number of lazy states'))
+
+
+## ------------- ##
+## Expressions.  ##
+## ------------- ##
+
+ctx = vcsn.context('lal_char(abc), q')
+exps = [ctx.expression('(<{}>a+b)*c{{{}}}'.format(n, n)) for n in range(1, 9)]
+
+check_threads(lambda e: e.derived_term().strip(), exps)
+check_threads(lambda e: e.standard().strip(), exps)
+check_threads(lambda e: e.thompson().proper().strip(), exps)
+
+
+## ---------------------------- ##
+## Concurrent context loading.  ##
+## ---------------------------- ##
+
+# Several threads may need the same plugins at the same time.
+ctxs = ['lal_char(ab), z', 'lal_char(ab), zmin', 'lal_char(ab), q',
+        'law_char(ab), z', 'lal_char(ab), b']
+check_threads(lambda c: str(vcsn.context(c)
+                            .expression('(<2>a+b)*').standard()
+                            .shortest(3)),
+              ctxs * 2)
+
+PLAN()
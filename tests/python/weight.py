@@ -56,6 +56,40 @@ CHECK_EQ(w('oo'), w('oo') + w('oo'))
 CHECK_EQ(w('799.99999'), w('800') + w('850'))
 CHECK_EQ(w('799.99999'), w('850') + w('800'))
 
+## ---------------------------- ##
+## Hybrid weightsets: zh, qh.  ##
+## ---------------------------- ##
+
+# Values are 64-bit integers, promoted to GMP on overflow.
+max64 = 2**63 - 1
+for ws in ['zh', 'qh']:
+    c = vcsn.context('lal_char(x), ' + ws)
+    w = lambda s: c.weight(str(s))
+    CHECK_EQ(w(max64 + 1), w(max64) + w(1))
+    CHECK_EQ(w(max64 * max64), w(max64) * w(max64))
+    CHECK_EQ(w(-max64 - 2), w(-max64) - w(2))
+    # Demotion: the result fits in 64 bits again.
+    CHECK_EQ(w(max64), (w(max64) + w(1)) + w(-1))
+    CHECK_EQ(w(2**100), w(2) ** 100)
+
+c = vcsn.context('lal_char(x), qh')
+w = lambda s: c.weight(str(s))
+CHECK_EQ(w('1/{}'.format(max64 * max64)), w('1/{}'.format(max64)) ** 2)
+CHECK_EQ(w(1), w('1/{}'.format(max64)) * w(max64))
+CHECK_EQ(w('7/16'), w('1/2') ** (2, 4))
+
+# The evaluation of a word may overflow 64 bits.
+a = vcsn.context('lal_char(a), zh').expression('(<3>a)*').automaton()
+CHECK_EQ(str(3**100), str(a.evaluate('a' * 100)))
+a = vcsn.context('lal_char(a), qh').expression('(<1/3>a)*').automaton()
+CHECK_EQ('1/{}'.format(3**100), str(a.evaluate('a' * 100)))
+
+# Join.
+CHECK_EQ(vcsn.context('lal_char(x), zh'),
+         vcsn.context('lal_char(x), z').join(vcsn.context('lal_char(x), zh')))
+CHECK_EQ(vcsn.context('lal_char(x), qh'),
+         vcsn.context('lal_char(x), zh').join(vcsn.context('lal_char(x), qh')))
+
 ## ---------------- ##
 ## Random Weights.  ##
 ## ---------------- ##
@@ -0,0 +1,98 @@
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <vcsn/misc/arena.hh>
+
+#include <tests/unit/test.hh>
+
+static unsigned
+check_reuse()
+{
+  unsigned nerrs = 0;
+  auto a = vcsn::make_arena();
+  auto p1 = a->allocate(24);
+  auto p2 = a->allocate(24);
+  ASSERT_EQ(a->size(), 2u);
+  ASSERT_EQ(p1 != p2, true);
+  // Freed cells are reused by allocations of the same size.
+  a->deallocate(p1, 24);
+  ASSERT_EQ(a->allocate(20), p1);
+  // Large objects are not pooled, but counted.
+  auto big = a->allocate(1 << 20);
+  ASSERT_EQ(a->size(), 3u);
+  a->deallocate(big, 1 << 20);
+  a->deallocate(p1, 20);
+  a->deallocate(p2, 24);
+  ASSERT_EQ(a->size(), 0u);
+  return nerrs;
+}
+
+static unsigned
+check_lifetime()
+{
+  unsigned nerrs = 0;
+  auto s = std::shared_ptr<const std::string>{};
+  {
+    auto a = vcsn::make_arena();
+    s = std::allocate_shared<const std::string>
+      (vcsn::arena_allocator<std::string>{*a}, "Hello, World!");
+    ASSERT_EQ(a->size(), 1u);
+  }
+  // The arena is still alive, since s lives in it.
+  ASSERT_EQ(*s, "Hello, World!");
+  s = nullptr;
+  return nerrs;
+}
+
+static unsigned
+check_containers()
+{
+  unsigned nerrs = 0;
+  auto a = vcsn::make_arena();
+  {
+    using alloc_t = vcsn::arena_allocator<int>;
+    auto v = std::vector<int, alloc_t>(alloc_t{*a});
+    for (int i = 0; i < 1000; ++i)
+      v.push_back(i);
+    auto sum = 0;
+    for (auto i: v)
+      sum += i;
+    ASSERT_EQ(sum, 499500);
+  }
+  ASSERT_EQ(a->size(), 0u);
+  return nerrs;
+}
+
+static unsigned
+check_threads()
+{
+  unsigned nerrs = 0;
+  auto a = vcsn::make_arena(true);
+  auto ts = std::vector<std::thread>{};
+  for (int t = 0; t < 4; ++t)
+    ts.emplace_back([&a, t]
+                    {
+                      auto ps = std::vector<void*>{};
+                      for (int i = 0; i < 10000; ++i)
+                        ps.push_back(a->allocate(8 + (i + t) % 64));
+                      for (int i = 0; i < 10000; ++i)
+                        a->deallocate(ps[i], 8 + (i + t) % 64);
+                    });
+  for (auto& t: ts)
+    t.join();
+  ASSERT_EQ(a->size(), 0u);
+  return nerrs;
+}
+
+int main()
+{
+  size_t nerrs = 0;
+  nerrs += check_reuse();
+  nerrs += check_lifetime();
+  nerrs += check_containers();
+  nerrs += check_threads();
+  return !!nerrs;
+}
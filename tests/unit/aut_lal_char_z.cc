@@ -1,5 +1,8 @@
 #undef NDEBUG
+#include <algorithm>
 #include <iostream>
+#include <tuple>
+#include <vector>
 #include <vcsn/algos/dot.hh>
 #include <vcsn/core/mutable-automaton.hh>
 #include <vcsn/misc/vector.hh> // make_vector
@@ -122,11 +125,103 @@ check_del_transition(const context_t& ctx)
   return nerrs;
 }
 
+/// Check that out(aut, s, l) agrees with a filter on all_out(aut, s).
+template <Automaton Aut>
+static size_t
+check_out(const Aut& aut)
+{
+  size_t nerrs = 0;
+  for (auto s: aut->states())
+    for (auto l: *aut->labelset())
+      {
+        auto exp = std::vector<vcsn::transition_t_of<Aut>>{};
+        for (auto t: all_out(aut, s))
+          if (aut->label_of(t) == l)
+            exp.push_back(t);
+        auto eff = vcsn::detail::make_vector(out(aut, s, l));
+        std::sort(exp.begin(), exp.end());
+        std::sort(eff.begin(), eff.end());
+        assert(exp == eff);
+      }
+  return nerrs;
+}
+
+static size_t
+check_label_index(const context_t& ctx)
+{
+  size_t nerrs = 0;
+  automaton_t aut = clique<automaton_t>(ctx, 3);
+  ASSERT_EQ(aut->label_index(), false);
+  nerrs += check_out(aut);
+
+  aut->set_label_index();
+  ASSERT_EQ(aut->label_index(), true);
+  nerrs += check_out(aut);
+  auto ss = vcsn::detail::make_vector(aut->states());
+  ASSERT_EQ(out(aut, ss[0], 'a').size(), 3u);
+
+  // Deletions.
+  del_transition(aut, ss[0], ss[1]);
+  aut->del_transition(ss[1], ss[2], 'c');
+  nerrs += check_out(aut);
+  ASSERT_EQ(out(aut, ss[0], 'a').size(), 2u);
+  ASSERT_EQ(out(aut, ss[1], 'c').size(), 2u);
+  aut->del_state(ss[2]);
+  nerrs += check_out(aut);
+  ASSERT_EQ(out(aut, ss[0], 'b').size(), 1u);
+
+  // Additions, including in recycled slots.
+  auto s = aut->new_state();
+  aut->new_transition(ss[0], s, 'a');
+  aut->set_transition(s, ss[0], 'b', 2);
+  aut->add_transition(s, ss[0], 'b', 3);
+  aut->set_transition(ss[1], ss[1], 'd', 0);
+  nerrs += check_out(aut);
+  ASSERT_EQ(out(aut, ss[0], 'a').size(), 2u);
+  ASSERT_EQ(out(aut, s, 'b').size(), 1u);
+  ASSERT_EQ(out(aut, ss[1], 'd').size(), 1u);
+
+  // Bulk insertion: merged and cancelled transitions are recycled,
+  // finalize must not leave them in the index.  Use a large
+  // out-degree, so that out() uses the index.
+  {
+    using tuple_t = std::tuple<vcsn::state_t_of<automaton_t>,
+                               vcsn::state_t_of<automaton_t>,
+                               char, int>;
+    auto ts = std::vector<tuple_t>{};
+    for (auto l: {'a', 'b', 'c', 'd'})
+      for (auto d: aut->states())
+        {
+          ts.emplace_back(s, d, l, 1);
+          ts.emplace_back(s, d, l, l == 'b' ? -1 : 1);
+        }
+    aut->new_transitions_unchecked(ts);
+    aut->finalize();
+    nerrs += check_out(aut);
+    // Only s -> ss[0], whose weight 5 is unchanged.
+    ASSERT_EQ(out(aut, s, 'b').size(), 1u);
+    ASSERT_EQ(out(aut, s, 'c').size(), 3u);
+    for (auto t: out(aut, s, 'c'))
+      ASSERT_EQ(aut->weight_of(t), 2);
+    // Recycle the freed transitions.
+    aut->new_transition(ss[1], s, 'b');
+    aut->new_transition(s, s, 'b', 5);
+    nerrs += check_out(aut);
+    ASSERT_EQ(out(aut, s, 'b').size(), 2u);
+  }
+
+  aut->set_label_index(false);
+  ASSERT_EQ(aut->label_index(), false);
+  nerrs += check_out(aut);
+  return nerrs;
+}
+
 int main()
 {
   size_t nerrs = 0;
   context_t ctx {{'a', 'b', 'c', 'd'}};
   nerrs += check_various(ctx);
   nerrs += check_del_transition(ctx);
+  nerrs += check_label_index(ctx);
   return !!nerrs;
 }
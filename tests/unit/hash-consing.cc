@@ -0,0 +1,123 @@
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <vcsn/core/rat/expressionset.hh>
+#include <vcsn/ctx/lal_char_z.hh>
+
+#include <tests/unit/test.hh>
+
+using context_t = vcsn::ctx::lal_char_z;
+using expressionset_t = vcsn::expressionset<context_t>;
+using expression_t = expressionset_t::value_t;
+
+/// (<2>a+b)*c(a+b), built from scratch.
+static expression_t
+make(const expressionset_t& rs)
+{
+  auto ab = rs.add(rs.lweight(2, rs.atom('a')), rs.atom('b'));
+  return rs.mul(rs.mul(rs.star(ab), rs.atom('c')),
+                rs.add(rs.atom('a'), rs.atom('b')));
+}
+
+static unsigned
+check_sharing()
+{
+  unsigned nerrs = 0;
+  auto ctx = context_t{{'a', 'b', 'c'}};
+  auto rs = expressionset_t{ctx, vcsn::rat::identities::associative};
+  ASSERT_EQ(rs.hash_consing(), false);
+  // Without hash-consing, equal expressions are different nodes.
+  ASSERT_EQ(make(rs) == make(rs), false);
+
+  rs.set_hash_consing();
+  ASSERT_EQ(rs.hash_consing(), true);
+  auto e1 = make(rs);
+  auto e2 = make(rs);
+  ASSERT_EQ(e1 == e2, true);
+  ASSERT_EQ(e1->is_consed(), true);
+  // Copies of the expressionset share the table.
+  auto rs2 = rs;
+  ASSERT_EQ(make(rs2) == e1, true);
+
+  rs.set_hash_consing(false);
+  ASSERT_EQ(rs.hash_consing(), false);
+  ASSERT_EQ(make(rs) == e1, false);
+  ASSERT_EQ(make(rs)->is_consed(), false);
+  return nerrs;
+}
+
+static unsigned
+check_set_weight()
+{
+  unsigned nerrs = 0;
+  using lweight_t = vcsn::rat::lweight<context_t>;
+  auto ctx = context_t{{'a', 'b', 'c'}};
+  auto rs = expressionset_t{ctx, vcsn::rat::identities::associative};
+  auto as_lweight = [](const expression_t& e)
+    {
+      return std::const_pointer_cast<lweight_t>
+        (std::dynamic_pointer_cast<const lweight_t>(e));
+    };
+
+  // Private nodes can be modified.
+  auto e = as_lweight(rs.lweight(2, rs.add(rs.atom('a'), rs.atom('b'))));
+  auto h = e->hash();
+  e->set_weight(3);
+  ASSERT_EQ(e->weight(), 3);
+  ASSERT_EQ(e->hash() != h, true);
+
+  // Shared nodes cannot: the other holders would see the change, and
+  // the table would be corrupted.
+  rs.set_hash_consing();
+  auto c1 = as_lweight(rs.lweight(2, rs.add(rs.atom('a'), rs.atom('b'))));
+  auto c2 = rs.lweight(2, rs.add(rs.atom('a'), rs.atom('b')));
+  ASSERT_EQ(expression_t{c1} == c2, true);
+  auto refused = false;
+  try
+    {
+      c1->set_weight(3);
+    }
+  catch (const std::runtime_error&)
+    {
+      refused = true;
+    }
+  ASSERT_EQ(refused, true);
+  ASSERT_EQ(c1->weight(), 2);
+  ASSERT_EQ(rs.lweight(2, rs.add(rs.atom('a'), rs.atom('b'))) == c2, true);
+  return nerrs;
+}
+
+static unsigned
+check_threads()
+{
+  unsigned nerrs = 0;
+  auto ctx = context_t{{'a', 'b', 'c'}};
+  auto rs = expressionset_t{ctx, vcsn::rat::identities::associative};
+  rs.set_hash_consing();
+  auto exps = std::vector<std::vector<expression_t>>(4);
+  auto ts = std::vector<std::thread>{};
+  for (auto& es: exps)
+    ts.emplace_back([&rs, &es]
+                    {
+                      for (int i = 0; i < 1000; ++i)
+                        es.emplace_back(make(rs));
+                    });
+  for (auto& t: ts)
+    t.join();
+  auto e = make(rs);
+  for (const auto& es: exps)
+    for (const auto& f: es)
+      ASSERT_EQ(e == f, true);
+  return nerrs;
+}
+
+int main()
+{
+  size_t nerrs = 0;
+  nerrs += check_sharing();
+  nerrs += check_set_weight();
+  nerrs += check_threads();
+  return !!nerrs;
+}
@@ -13,6 +13,7 @@
 
 # Not check_PROGRAMS, see below why.
 EXTRA_PROGRAMS +=                               \
+  %D%/arena                                     \
   %D%/aut_lal_char_z                            \
   %D%/aut_lao_z                                 \
   %D%/aut_law_char_z                            \
@@ -20,9 +21,11 @@ EXTRA_PROGRAMS +=                               \
   %D%/cross                                     \
   %D%/distance                                  \
   %D%/dyn                                       \
+  %D%/hash-consing                              \
   %D%/label                                     \
   %D%/polynomialset                             \
   %D%/proper                                    \
+  %D%/properties                                \
   %D%/transpose                                 \
   %D%/weight                                    \
   %D%/zip                                       \
@@ -32,29 +35,35 @@ unit_ldadd = $(libvcsn) $(RT_LIBS)
 
 noinst_HEADERS = %D%/test.hh %D%/weight.hh
 
+%C%_arena_LDADD          = $(unit_ldadd)
 %C%_aut_lal_char_z_LDADD = $(unit_ldadd)
 %C%_aut_lao_z_LDADD      = $(unit_ldadd)
 %C%_aut_law_char_z_LDADD = $(unit_ldadd)
 %C%_concat_LDADD         = $(unit_ldadd)
 %C%_distance_LDADD       = $(unit_ldadd)
 %C%_dyn_LDADD            = $(unit_ldadd)
+%C%_hash_consing_LDADD   = $(unit_ldadd)
 %C%_label_LDADD          = $(unit_ldadd)
 %C%_polynomialset_LDADD  = $(unit_ldadd)
 %C%_proper_LDADD         = $(unit_ldadd)
+%C%_properties_LDADD     = $(unit_ldadd)
 %C%_transpose_LDADD      = $(unit_ldadd)
-%C%_weight_LDADD         = $(unit_ldadd)
+%C%_weight_LDADD         = $(unit_ldadd) -lgmpxx -lgmp
 
 %C%_TESTS =                                     \
+  %D%/arena.chk                                 \
   %D%/aut_lal_char_z.chk                        \
   %D%/aut_lao_z.chk                             \
   %D%/aut_law_char_z.chk                        \
   %D%/concat.chk                                \
   %D%/cross.chk                                 \
   %D%/dyn.chk                                   \
+  %D%/hash-consing.chk                          \
   %D%/ipython.chk                               \
   %D%/label.chk                                 \
   %D%/polynomialset.chk                         \
   %D%/proper.chk                                \
+  %D%/properties.chk                            \
   %D%/pylint.chk                                \
   %D%/score.chk                                 \
   %D%/score-compare.chk                         \
@@ -69,6 +78,9 @@ EXTRA_DIST +=                                   \
   %D%/score-compare.dir/all.csv                 \
   %D%/score-compare.dir/all.tex                 \
   %D%/score-compare.dir/all.txt                 \
+  %D%/score-compare.dir/bench-1.json            \
+  %D%/score-compare.dir/bench-2.json            \
+  %D%/score-compare.dir/bench.txt               \
   %D%/score-compare.dir/default.txt             \
   %D%/score-compare.dir/shortest.txt            \
   %D%/score-compare.dir/v2.0-0001-g6bfe026      \
@@ -79,6 +91,7 @@ EXTRA_DIST +=                                   \
 # Instead of using check_PROGRAMS, use EXTRA_PROGRAMS, but spell out
 # the dependencies, so that the test suite does not make useless
 # compilations.
+%D%/arena.log:          %D%/arena
 %D%/aut_lal_char_z.log: %D%/aut_lal_char_z
 %D%/aut_lao_z.log:      %D%/aut_lao_z
 %D%/aut_law_char_z.log: %D%/aut_law_char_z
@@ -0,0 +1,134 @@
+#undef NDEBUG
+
+#include <string>
+
+#include <vcsn/algos/accessible.hh>
+#include <vcsn/algos/determinize.hh>
+#include <vcsn/algos/is-complete.hh>
+#include <vcsn/algos/is-deterministic.hh>
+#include <vcsn/algos/transpose.hh>
+#include <vcsn/core/mutable-automaton.hh>
+#include <vcsn/ctx/lal_char_b.hh>
+
+// Include this one last, as it defines a macro `V`, which is used as
+// a template parameter in boost/unordered/detail/allocate.hpp.
+#include "tests/unit/test.hh"
+
+using automaton_t = vcsn::mutable_automaton<vcsn::ctx::lal_char_b>;
+using state_t = vcsn::state_t_of<automaton_t>;
+
+/// The memoized value of \a p in \a aut.
+template <typename Aut>
+static std::string
+cached(const Aut& aut, vcsn::property p)
+{
+  auto res = aut->properties().get(p);
+  return res ? (*res ? "true" : "false") : "unknown";
+}
+
+/// (a+b)*a.
+static automaton_t
+make_automaton()
+{
+  auto ctx = vcsn::ctx::lal_char_b{{'a', 'b'}};
+  auto res = vcsn::make_mutable_automaton(ctx);
+  auto s0 = res->new_state();
+  auto s1 = res->new_state();
+  res->set_initial(s0);
+  res->new_transition(s0, s0, 'a');
+  res->new_transition(s0, s0, 'b');
+  res->new_transition(s0, s1, 'a');
+  res->set_final(s1);
+  return res;
+}
+
+static unsigned
+check_invalidation()
+{
+  unsigned nerrs = 0;
+  auto a = make_automaton();
+  auto s0 = state_t{2};
+  auto s1 = state_t{3};
+  ASSERT_EQ(cached(a, vcsn::property::deterministic), "unknown");
+
+  // Computed once, then memoized.
+  ASSERT_EQ(vcsn::is_deterministic(a), false);
+  ASSERT_EQ(cached(a, vcsn::property::deterministic), "false");
+  ASSERT_EQ(cached(a, vcsn::property::accessible), "unknown");
+  ASSERT_EQ(vcsn::is_accessible(a), true);
+  ASSERT_EQ(cached(a, vcsn::property::accessible), "true");
+
+  // Any modification forgets everything.
+  a->del_transition(a->get_transition(s0, s1, 'a'));
+  ASSERT_EQ(cached(a, vcsn::property::deterministic), "unknown");
+  ASSERT_EQ(cached(a, vcsn::property::accessible), "unknown");
+  ASSERT_EQ(vcsn::is_deterministic(a), true);
+  ASSERT_EQ(vcsn::is_accessible(a), false);
+
+  auto s = a->new_state();
+  ASSERT_EQ(cached(a, vcsn::property::accessible), "unknown");
+  a->new_transition(s0, s, 'a');
+  ASSERT_EQ(vcsn::is_accessible(a), false);
+  a->del_state(s1);
+  ASSERT_EQ(vcsn::is_accessible(a), true);
+  ASSERT_EQ(vcsn::is_complete(a), false);
+  a->new_transition(s, s, 'a');
+  a->new_transition(s, s, 'b');
+  ASSERT_EQ(vcsn::is_complete(a), true);
+  a->set_weight(a->get_transition(s, s, 'b'), false);
+  ASSERT_EQ(vcsn::is_complete(a), false);
+  return nerrs;
+}
+
+static unsigned
+check_open_alphabet()
+{
+  unsigned nerrs = 0;
+  auto a = make_automaton();
+  auto s0 = state_t{2};
+  auto s1 = state_t{3};
+  a->new_transition(s1, s1, 'a');
+  a->new_transition(s1, s1, 'b');
+  ASSERT_EQ(vcsn::is_complete(a), true);
+
+  // The alphabet, open, grows without the automaton being modified.
+  const auto& ls = *a->labelset();
+  ls.open(true);
+  ASSERT_EQ(ls.has('c'), true);
+  ls.open(false);
+  ASSERT_EQ(vcsn::is_complete(a), false);
+  a->new_transition(s0, s0, 'c');
+  a->new_transition(s1, s1, 'c');
+  ASSERT_EQ(vcsn::is_complete(a), true);
+  return nerrs;
+}
+
+static unsigned
+check_decorators()
+{
+  unsigned nerrs = 0;
+  auto a = make_automaton();
+
+  // Determinization seeds the properties of its result.
+  auto d = vcsn::determinize(a);
+  ASSERT_EQ(cached(d, vcsn::property::deterministic), "true");
+  ASSERT_EQ(cached(d->strip(), vcsn::property::accessible), "true");
+
+  // The transposed automaton does not share the cache of its input:
+  // it is not deterministic.
+  ASSERT_EQ(vcsn::is_deterministic(d), true);
+  ASSERT_EQ(vcsn::is_deterministic(vcsn::transpose(d)), false);
+  ASSERT_EQ(vcsn::detail::has_properties_mem_fn
+            <decltype(vcsn::transpose(d))>::value, false);
+  ASSERT_EQ(vcsn::is_deterministic(d), true);
+  return nerrs;
+}
+
+int main()
+{
+  size_t nerrs = 0;
+  nerrs += check_invalidation();
+  nerrs += check_open_alphabet();
+  nerrs += check_decorators();
+  return !!nerrs;
+}
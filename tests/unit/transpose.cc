@@ -81,11 +81,48 @@ check_mutable_automaton()
   return nerrs;
 }
 
+/// The dot output of \a aut.
+template <typename Aut>
+static std::string
+dot_of(const Aut& aut)
+{
+  std::ostringstream os;
+  vcsn::dot(aut, os);
+  return os.str();
+}
+
+static size_t
+check_copy_into()
+{
+  size_t nerrs = 0;
+  auto ctx = vcsn::ctx::lal_char_b{{'a', 'b'}};
+  auto aut = vcsn::make_mutable_automaton(ctx);
+  auto s0 = aut->new_state();
+  auto s1 = aut->new_state();
+  aut->set_initial(s0);
+  aut->new_transition(s0, s0, 'b');
+  aut->new_transition(s0, s1, 'a');
+  aut->set_final(s1);
+
+  // Copying into the transposed view builds the transposed automaton,
+  // whether transitions are inserted one by one (safe), or in bulk.
+  for (auto safe: {true, false})
+    {
+      auto res = vcsn::make_mutable_automaton(ctx);
+      auto tres = vcsn::transpose(res);
+      vcsn::copy_into(aut, tres, safe);
+      ASSERT_EQ(dot_of(tres), dot_of(aut));
+      ASSERT_EQ(dot_of(res), dot_of(vcsn::transpose(aut)));
+    }
+  return nerrs;
+}
+
 int main()
 {
   unsigned errs = 0;
 
   errs += check_mutable_automaton();
+  errs += check_copy_into();
 
   return !!errs;
 }
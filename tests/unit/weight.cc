@@ -5,8 +5,10 @@
 #include <vcsn/weightset/log.hh>
 #include <vcsn/weightset/r.hh>
 #include <vcsn/weightset/q.hh>
+#include <vcsn/weightset/qh.hh>
 #include <vcsn/weightset/nmin.hh>
 #include <vcsn/weightset/rmin.hh>
+#include <vcsn/weightset/zh.hh>
 #include <vcsn/weightset/zmin.hh>
 
 #include "tests/unit/weight.hh"
@@ -168,6 +170,125 @@ static size_t check_q()
   return nerrs;
 }
 
+static size_t check_zh()
+{
+  size_t nerrs = 0;
+  vcsn::zh ws;
+
+  nerrs += check_common(ws);
+
+  const auto max = std::to_string(std::numeric_limits<std::int64_t>::max());
+  const auto min = std::to_string(std::numeric_limits<std::int64_t>::min());
+
+  // conv, format.
+#define CHECK(In, Out)                          \
+  ASSERT_EQ(to_string(ws, conv(ws, In)), Out)
+
+  CHECK("0", "0");
+  CHECK("-42", "-42");
+  CHECK(max, max);
+  CHECK(min, min);
+  CHECK("123456789012345678901234567890", "123456789012345678901234567890");
+#undef CHECK
+
+  // Overflows are promoted to GMP, and results that fit are demoted.
+#define CHECK(Op, Lhs, Rhs, Out)                                        \
+  ASSERT_EQ(to_string(ws, ws.Op(conv(ws, Lhs), conv(ws, Rhs))), Out)
+
+  CHECK(add, max, "1",  "9223372036854775808");
+  CHECK(sub, min, "1",  "-9223372036854775809");
+  CHECK(mul, max, max,  "85070591730234615847396907784232501249");
+  CHECK(mul, "4294967296", "4294967296", "18446744073709551616");
+  CHECK(sub, "9223372036854775808", "1", max);
+  CHECK(add, "-9223372036854775809", "1", min);
+  CHECK(rdivide, "18446744073709551616", "4294967296", "4294967296");
+  CHECK(rdivide, min, "-1", "9223372036854775808");
+#undef CHECK
+
+  // min, max: the range of the inline values.
+  ASSERT_EQ(to_string(ws, ws.max()), max);
+  ASSERT_EQ(to_string(ws, ws.min()), min);
+
+  // The representation is unique.
+  {
+    auto big = ws.add(conv(ws, max), ws.one());
+    auto back = ws.sub(big, ws.one());
+    ASSERT_EQ(back.is_small(), true);
+    ASSERT_VS_EQ(ws, back, conv(ws, max));
+    ASSERT_EQ(ws.hash(back), ws.hash(conv(ws, max)));
+    ASSERT_EQ(ws.less(conv(ws, max), big), true);
+    ASSERT_EQ(ws.less(big, conv(ws, max)), false);
+  }
+
+  return nerrs;
+}
+
+static size_t check_qh()
+{
+  size_t nerrs = 0;
+  vcsn::qh ws;
+
+  nerrs += check_common(ws);
+
+  const auto max = std::to_string(std::numeric_limits<std::int64_t>::max());
+
+  // conv, format.
+#define CHECK(In, Out)                          \
+  ASSERT_EQ(to_string(ws, conv(ws, In)), Out)
+
+  CHECK("-3/2",  "-3/2");
+  CHECK("-42/2", "-21");
+  CHECK("1/-2",  "-1/2");
+  CHECK("-1/-2", "1/2");
+  CHECK("0/5",   "0");
+  CHECK("1/" + max + "0", "1/" + max + "0");
+#undef CHECK
+
+#define CHECK(Op, Lhs, Rhs, Out)                                        \
+  ASSERT_EQ(to_string(ws, ws.Op(conv(ws, Lhs), conv(ws, Rhs))), Out)
+
+  CHECK(add, "1/3", "1/6", "1/2");
+  CHECK(add, "168/9", "14/13", "770/39");
+  CHECK(mul, "-3/2", "2/3", "-1");
+  CHECK(rdivide, "1/2", "-1/4", "-2");
+  // Overflows are promoted to GMP, and results that fit are demoted.
+  CHECK(mul, "1/" + max, "1/" + max,
+        "1/85070591730234615847396907784232501249");
+  CHECK(add, "1/" + max, "1/9223372036854775783",
+        "18446744073709551590/85070591730234615626035978899717881881");
+  CHECK(mul, "1/" + max, max, "1");
+  CHECK(add, max, max, "18446744073709551614");
+#undef CHECK
+
+  // star.
+#define CHECK(In, Out)                          \
+  ASSERT_EQ(to_string(ws, ws.star(conv(ws, In))), Out)
+
+  CHECK("1/2", "2");
+  CHECK("-1/2", "2/3");
+  CHECK("1/" + max + "0", max + "0/" + "92233720368547758069");
+  // d - n overflows.
+  CHECK("-4611686018427387904/4611686018427387905",
+        "4611686018427387905/9223372036854775809");
+  CHECK("-" + std::to_string(std::numeric_limits<std::int64_t>::max() - 1)
+        + "/" + max,
+        max + "/18446744073709551613");
+#undef CHECK
+
+  // min, max: the range of the inline values.
+  ASSERT_EQ(to_string(ws, ws.max()), max);
+  ASSERT_EQ(to_string(ws, ws.min()),
+            std::to_string(std::numeric_limits<std::int64_t>::min()));
+
+  // compare.
+  ASSERT_EQ(ws.less(conv(ws, "1/" + max), conv(ws, "1/" + max + "0")),
+            false);
+  ASSERT_EQ(ws.less(conv(ws, "-1/2"), conv(ws, "1/3")), true);
+  ASSERT_EQ(ws.equal(conv(ws, "8/16"), conv(ws, "1/2")), true);
+
+  return nerrs;
+}
+
 static size_t check_r()
 {
   size_t nerrs = 0;
@@ -336,5 +457,7 @@ int main()
   nerrs += check_tropical_min<vcsn::rmin>();
   nerrs += check_r();
   nerrs += check_q();
+  nerrs += check_zh();
+  nerrs += check_qh();
   return !!nerrs;
 }
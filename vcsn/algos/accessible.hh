@@ -5,6 +5,7 @@
 
 #include <vcsn/algos/filter.hh>
 #include <vcsn/algos/transpose.hh>
+#include <vcsn/core/property-cache.hh>
 #include <vcsn/dyn/fwd.hh>
 #include <vcsn/misc/attributes.hh>
 #include <vcsn/misc/unordered_set.hh>
@@ -178,7 +179,9 @@ namespace vcsn
   template <Automaton Aut>
   bool is_accessible(const Aut& a)
   {
-    return num_accessible_states(a) == a->num_states();
+    return cached_property
+      (a, property::accessible,
+       [&a] { return num_accessible_states(a) == a->num_states(); });
   }
 
   /// Whether all its states are coaccessible.
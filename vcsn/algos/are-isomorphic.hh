@@ -10,6 +10,7 @@
 #include <boost/range/algorithm/sort.hpp>
 
 #include <vcsn/algos/accessible.hh>
+#include <vcsn/algos/fingerprint.hh>
 #include <vcsn/dyn/automaton.hh>
 #include <vcsn/dyn/fwd.hh>
 #include <vcsn/misc/functional.hh>
@@ -66,6 +67,10 @@ namespace vcsn
     automaton1_t a1_;
     automaton2_t a2_;
 
+    /// The color refinements of a1_ and a2_.
+    wl_coloring<automaton1_t> colors1_;
+    wl_coloring<automaton2_t> colors2_;
+
     /// See the comment for out_ in minimize.hh.
     template <Automaton Aut>
     using dout_t =
@@ -123,7 +128,8 @@ namespace vcsn
         nocounterexample = 2,     // Exhaustive tests failed [we do this only
                                   // for non-sequential automata].
         trivially_different  = 3, // Different number of states or transitions,
-                                  // of different sequentiality.
+                                  // of different sequentiality, or of
+                                  // different state colors.
       };
 
       tag response = tag::never_computed;
@@ -194,10 +200,32 @@ namespace vcsn
               || a1_->num_transitions() != a2_->num_transitions());
     }
 
+    /// Whether the color refinements of both automata agree at each
+    /// round.  If they don't, the automata are not isomorphic.
+    ///
+    /// Costs O(m log n) per round, and in the nonsequential case,
+    /// makes the state classes much finer.
+    bool same_colors_()
+    {
+      while (true)
+        {
+          if (colors1_.histogram() != colors2_.histogram())
+            return false;
+          if (colors1_.rounds() == colors1_.max_rounds)
+            return true;
+          auto split1 = colors1_.refine();
+          auto split2 = colors2_.refine();
+          if (!split1 && !split2)
+            return colors1_.histogram() == colors2_.histogram();
+        }
+    }
+
   public:
     are_isomorphic_impl(const Aut1 &a1, const Aut2 &a2)
       : a1_(a1)
       , a2_(a2)
+      , colors1_(a1_)
+      , colors2_(a2_)
     {}
 
     full_response
@@ -217,7 +245,7 @@ namespace vcsn
       // Before even initializing our data structures, which is
       // potentially expensive, try to simply compare the number of
       // elements such as states and transitions.
-      if (trivially_different())
+      if (trivially_different() || !same_colors_())
         return fr_;
 
       if (is_sequential_filling(a1_, dout1_))
@@ -248,9 +276,10 @@ namespace vcsn
     state_classes_t state_classes_;
 
     template <Automaton Aut>
-    class_id state_to_class(state_t_of<Aut> s, Aut& a)
+    class_id state_to_class(state_t_of<Aut> s, Aut& a,
+                            const wl_coloring<Aut>& colors)
     {
-      class_id res = 0;
+      class_id res = colors.colors()[s];
 
       hash_combine(res, s == a->pre());
       hash_combine(res, s == a->post());
@@ -308,9 +337,9 @@ namespace vcsn
       auto table
         = std::unordered_map<class_id, std::pair<states1_t, states2_t>>{};
       for (auto s1: a1_->all_states())
-        table[state_to_class(s1, a1_)].first.emplace_back(s1);
+        table[state_to_class(s1, a1_, colors1_)].first.emplace_back(s1);
       for (auto s2: a2_->all_states())
-        table[state_to_class(s2, a2_)].second.emplace_back(s2);
+        table[state_to_class(s2, a2_, colors2_)].second.emplace_back(s2);
 
       // Return a table without class hashes sorted by decreasing
       // (left) size, in order to perform the most constrained choices
@@ -1,5 +1,11 @@
 #pragma once
 
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/range/algorithm/sort.hpp>
+
 #include <vcsn/algos/focus.hh>
 #include <vcsn/algos/insplit.hh>
 #include <vcsn/core/lazy-tuple-automaton.hh>
@@ -8,6 +14,8 @@
 #include <vcsn/ctx/context.hh>
 #include <vcsn/dyn/automaton.hh> // dyn::make_automaton
 #include <vcsn/labelset/tupleset.hh>
+#include <vcsn/misc/escape.hh> // str_quote
+#include <vcsn/misc/parallel.hh>
 #include <vcsn/misc/raise.hh>
 #include <vcsn/misc/tuple.hh> // make_index_sequence, cross_tuple
 #include <vcsn/misc/zip-maps.hh>
@@ -167,6 +175,56 @@ namespace vcsn
             }
       }
 
+      /// The (accessible part of the) composition of \a lhs_ and \a
+      /// rhs_, using \a num_threads threads (0 for as many as
+      /// supported by the hardware).
+      ///
+      /// The states are explored level by level (breadth first).  The
+      /// transitions leaving the states of a level are computed
+      /// concurrently, and their destinations looked up in the table
+      /// of state names, which is read-only during this phase.  Then
+      /// the new states are numbered and the transitions created
+      /// sequentially, in the order of the level: the result is
+      /// exactly the automaton built by compose().
+      ///
+      /// Values that cannot be built concurrently (e.g., expressions)
+      /// are computed by a single thread.
+      void compose_parallel(unsigned num_threads)
+      {
+        static_assert(!Lazy, "compose: parallel: cannot be lazy");
+        if (!is_thread_safe<context_t>{})
+          num_threads = 1;
+        initialize_compose();
+
+        auto level = std::vector<std::pair<state_name_t, state_t>>{};
+        auto results = std::vector<successors_t>{};
+        while (!aut_->todo_.empty())
+          {
+            level.assign(aut_->todo_.begin(), aut_->todo_.end());
+            aut_->todo_.clear();
+            // Filling the transition caches is not thread-safe.
+            for (const auto& p: level)
+              {
+                std::get<0>(transition_maps_)[std::get<0>(p.first)];
+                std::get<1>(transition_maps_)[std::get<1>(p.first)];
+              }
+            results.resize(level.size());
+            detail::parallel_for(level.size(), num_threads,
+                                 [&](size_t i)
+                                 {
+                                   results[i] = successors_(level[i].first);
+                                 }, 16);
+            for (size_t i = 0; i < level.size(); ++i)
+              {
+                const auto src = level[i].second;
+                const auto& psrc = level[i].first;
+                add_one_transitions_<0>(src, psrc);
+                add_one_transitions_<1>(src, psrc);
+                add_successors_(src, results[i]);
+              }
+          }
+      }
+
       /// Callback for complete_ when lazy.
       void add_transitions(const state_t src,
                            const state_name_t& psrc)
@@ -317,6 +375,91 @@ namespace vcsn
             this->new_transition(src, elt.first, m.first, m.second);
       }
 
+      using polynomialset_t
+        = polynomialset<context_t, wet_kind_t::unordered_map>;
+      using polynomial_t = typename polynomialset_t::value_t;
+
+      /// A successor of a state, and the labels and weights of the
+      /// transitions to it.
+      struct successor_t
+      {
+        state_name_t name;
+        /// The state, if known, otherwise null_state().
+        state_t state;
+        polynomial_t poly;
+      };
+      /// The successors, in the order of their first transition.
+      using successors_t = std::vector<successor_t>;
+
+      /// The successors of state \a psrc via non spontaneous
+      /// transitions, as add_compose_transitions would create them.
+      /// Does not modify the automaton, and, provided the transition
+      /// caches of \a psrc are already built, is thread-safe.
+      successors_t successors_(const state_name_t& psrc)
+      {
+        const auto& lhs = std::get<0>(aut_->auts_);
+        const auto& rhs = std::get<1>(aut_->auts_);
+
+        // Outgoing transition cache.
+        const auto& ltm = std::get<0>(transition_maps_)[std::get<0>(psrc)];
+        const auto& rtm = std::get<1>(transition_maps_)[std::get<1>(psrc)];
+
+        const auto ps = polynomialset_t(aut_->context());
+        auto res = successors_t{};
+        // Name -> index in res.
+        auto index = std::unordered_map<state_name_t, size_t>{};
+        for (const auto& t: zip_maps(ltm, rtm))
+          // The type of the common label is that of the visible tape
+          // of either automata.
+          if (!lhs->labelset()->is_one(t.first))
+            // These may not be new transitions: as the automata are focus,
+            // there might be two transitions with the same destination and
+            // label, with only the hidden part that changes.
+            cross_tuple
+              ([&] (const typename transition_map_t<Lhs>::transition& lts,
+                    const typename transition_map_t<Rhs>::transition& rts)
+               {
+                 auto name = state_name_t{lts.dst, rts.dst};
+                 auto i = index.emplace(name, res.size());
+                 if (i.second)
+                   {
+                     auto j = aut_->pmap_().find(name);
+                     auto s = j == aut_->pmap_().end()
+                       ? aut_->null_state() : j->second;
+                     res.push_back({name, s, ps.zero()});
+                   }
+                 // Cache the transitions.
+                 ps.add_here(res[i.first->second].poly,
+                             join_label(lhs->hidden_label_of(lts.transition),
+                                        real_aut(rhs)->hidden_label_of(rts.transition)),
+                             this->weightset()->mul(lts.weight(), rts.weight()));
+               },
+               t.second);
+        return res;
+      }
+
+      /// Add the transitions from \a src to its successors.
+      void add_successors_(const state_t src, successors_t& succs)
+      {
+        // The states, in the order of their first transition, so
+        // that the new ones are numbered in this order.
+        auto states = std::vector<std::pair<state_t, size_t>>{};
+        states.reserve(succs.size());
+        for (size_t i = 0; i < succs.size(); ++i)
+          {
+            auto& s = succs[i];
+            if (s.state == aut_->null_state())
+              s.state = this->state(s.name);
+            states.emplace_back(s.state, i);
+          }
+        // For each successor, by increasing state number, add a
+        // transition for each monomial of the corresponding
+        // polynomial.
+        boost::sort(states);
+        for (const auto& s: states)
+          for (const auto& m: succs[s.second].poly)
+            this->new_transition(src, s.first, m.first, m.second);
+      }
 
       template <std::size_t I>
       void add_one_transitions_(const state_t src, const state_name_t& psrc)
@@ -478,6 +621,18 @@ namespace vcsn
     return res->strip();
   }
 
+  /// Build the (accessible part of the) composition, using \a
+  /// num_threads threads (0 for as many as supported by the hardware).
+  template <Automaton Lhs, Automaton Rhs,
+            std::size_t OutTape = 1, std::size_t InTape = 0>
+  auto
+  compose_parallel(const Lhs& lhs, const Rhs& rhs, unsigned num_threads = 0)
+  {
+    auto res = make_compose_automaton<false, OutTape, InTape>(lhs, rhs);
+    res->compose_parallel(num_threads);
+    return res->strip();
+  }
+
   /// Build the (accessible part of the) lazy composition.
   template <typename Lhs, typename Rhs,
             std::size_t OutTape = 1, std::size_t InTape = 0>
@@ -494,16 +649,22 @@ namespace vcsn
     namespace detail
     {
       /// Bridge.
-      template <Automaton Lhs, Automaton Rhs, typename Bool>
+      template <Automaton Lhs, Automaton Rhs, typename String>
       automaton
-      compose(const automaton& lhs, const automaton& rhs, bool lazy)
+      compose(const automaton& lhs, const automaton& rhs,
+              const std::string& algo)
       {
         auto& l = lhs->as<Lhs>();
         auto& r = rhs->as<Rhs>();
-        if (lazy)
+        if (algo == "auto" || algo == "standard")
+          return ::vcsn::compose(l, r);
+        else if (algo == "lazy")
           return ::vcsn::compose_lazy(l, r);
+        else if (algo == "parallel")
+          return ::vcsn::compose_parallel(l, r);
         else
-          return ::vcsn::compose(l, r);
+          raise("compose: invalid algorithm: ", str_quote(algo),
+                R"(, expected: "auto", "lazy", "parallel", "standard")");
       }
     }
   }
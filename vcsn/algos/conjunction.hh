@@ -1,8 +1,13 @@
 #pragma once
 
+#include <algorithm> // find_if
+#include <cstdint>
 #include <iostream>
 #include <map>
 #include <utility>
+#include <vector>
+
+#include <boost/range/iterator_range.hpp>
 
 #include <vcsn/algos/copy.hh>
 #include <vcsn/algos/insplit.hh>
@@ -98,15 +103,7 @@ namespace vcsn
       /// Compute the (accessible part of the) conjunction.
       void conjunction()
       {
-        initialize_conjunction();
-
-        if (!Lazy)
-          while (!aut_->todo_.empty())
-            {
-              const auto& p = aut_->todo_.front();
-              add_conjunction_transitions(std::get<1>(p), std::get<0>(p));
-              aut_->todo_.pop_front();
-            }
+        conjunction_(bool_constant<dense_>{});
       }
 
       /// Compute the left quotient
@@ -264,6 +261,175 @@ namespace vcsn
       }
 
     private:
+      /// Whether the conjunction can be computed by the dense engine:
+      /// eager, and without spontaneous transitions.
+      static constexpr bool dense_
+        = !Lazy && all_<!labelset_t_of<Auts>::has_one()...>();
+
+      /// The general conjunction.
+      void conjunction_(std::false_type)
+      {
+        initialize_conjunction();
+
+        if (!Lazy)
+          while (!aut_->todo_.empty())
+            {
+              const auto& p = aut_->todo_.front();
+              add_conjunction_transitions(std::get<1>(p), std::get<0>(p));
+              aut_->todo_.pop_front();
+            }
+      }
+
+      /// The conjunction of automata without spontaneous transitions.
+      ///
+      /// The outgoing transitions of the operands are stored in
+      /// contiguous arrays sorted by label, and merge-joined.  The
+      /// tuples of states are numbered via an open addressing table,
+      /// and registered in the origins once, at the end.  The result
+      /// is the same as with the general algorithm, including the
+      /// numbering of the states.
+      void conjunction_(std::true_type)
+      {
+        conjunction_dense_(aut_->indices);
+      }
+
+      template <size_t... I>
+      void conjunction_dense_(seq<I...>)
+      {
+        auto outs
+          = std::make_tuple(sorted_transitions<input_automaton_t<I>,
+                                               weightset_t>
+                            {std::get<I>(aut_->auts_), ws_}...);
+        dense_register_(aut_->pre_(), aut_->pre());
+        dense_register_(aut_->post_(), aut_->post());
+        // The states are processed in the order of their creation,
+        // as with the worklist of the general algorithm.
+        for (size_t i = 0; i < dense_names_.size(); ++i)
+          if (dense_states_[i] != aut_->post())
+            {
+              const auto& name = dense_names_[i];
+              auto ts = std::make_tuple(std::get<I>(outs)
+                                        [std::get<I>(name)]...);
+              add_dense_transitions_(dense_states_[i], ts, aut_->indices);
+            }
+        aut_->pmap_().rehash(dense_names_.size());
+        for (size_t i = 2; i < dense_names_.size(); ++i)
+          aut_->pmap_().insert({dense_names_[i], dense_states_[i]});
+        dense_names_.clear();
+        dense_states_.clear();
+        dense_table_.clear();
+        dense_bits_ = 0;
+      }
+
+      /// Add the transitions from \a src, given the outgoing
+      /// transitions of its components, sorted by label.
+      template <typename Transitions, size_t... I>
+      void add_dense_transitions_(const state_t src, const Transitions& ts,
+                                  seq<I...>)
+      {
+        const auto& ls = *aut_->labelset();
+        auto is = std::make_tuple(std::get<I>(ts).begin()...);
+        using swallow = int[];
+        while (all(std::get<I>(is) != std::get<I>(ts).end()...))
+          {
+            // The largest of the current labels: the others must
+            // catch up.
+            auto l = std::get<0>(is)->label;
+            auto max_label = [&ls, &l](const auto& i)
+              {
+                if (ls.less(l, i->label))
+                  l = i->label;
+              };
+            (void) swallow{(max_label(std::get<I>(is)), 0)...};
+            // Skip the transitions with smaller labels.  Whether we
+            // reached a transition labeled by l.
+            auto skip = [&ls, &l](auto& i, const auto& r)
+              {
+                i = std::find_if(i, r.end(),
+                                 [&ls, &l](const auto& t)
+                                 {
+                                   return !ls.less(t.label, l);
+                                 });
+                return i != r.end() && !ls.less(l, i->label);
+              };
+            if (all(skip(std::get<I>(is), std::get<I>(ts))...))
+              {
+                // The end of the transitions labeled by l.
+                auto es = std::make_tuple
+                  (std::find_if(std::get<I>(is), std::get<I>(ts).end(),
+                                [&ls, &l](const auto& t)
+                                {
+                                  return ls.less(l, t.label);
+                                })...);
+                detail::cross
+                  ([this, src, &l](const auto&... t)
+                   {
+                     this->new_transition(src, dense_state_(t.dst...),
+                                          l, ws_.mul(t.weight()...));
+                   },
+                   boost::make_iterator_range(std::get<I>(is),
+                                              std::get<I>(es))...);
+                is = es;
+              }
+          }
+      }
+
+      /// The result state for a tuple of states, created if needed.
+      template <typename... States>
+      state_t dense_state_(States... ss)
+      {
+        return dense_register_(state_name_t{ss...}, aut_->null_state());
+      }
+
+      /// The result state for \a name.  If needed, register it, as
+      /// \a s if valid, otherwise as a new state.
+      state_t dense_register_(const state_name_t& name, state_t s)
+      {
+        // Keep the load factor below 1/2.
+        if (dense_table_.size() <= 2 * dense_names_.size())
+          {
+            dense_bits_ = std::max(6u, dense_bits_ + 1);
+            dense_table_.assign(size_t{1} << dense_bits_, -1U);
+            for (unsigned i = 0; i < dense_names_.size(); ++i)
+              dense_table_[dense_slot_(dense_names_[i])] = i;
+          }
+        auto slot = dense_slot_(name);
+        if (dense_table_[slot] == -1U)
+          {
+            if (s == aut_->null_state())
+              s = aut_->new_state();
+            dense_table_[slot] = dense_names_.size();
+            dense_names_.emplace_back(name);
+            dense_states_.emplace_back(s);
+            return s;
+          }
+        else
+          return dense_states_[dense_table_[slot]];
+      }
+
+      /// The slot of \a name in dense_table_: either its index, or a
+      /// free one.
+      size_t dense_slot_(const state_name_t& name) const
+      {
+        const auto mask = dense_table_.size() - 1;
+        // Fibonacci hashing, to spread the tuples of small integers.
+        auto h = std::uint64_t{std::hash<state_name_t>{}(name)};
+        size_t res = (h * 0x9E3779B97F4A7C15ULL) >> (64 - dense_bits_);
+        while (dense_table_[res] != -1U
+               && dense_names_[dense_table_[res]] != name)
+          res = (res + 1) & mask;
+        return res;
+      }
+
+      /// Tuples of states, in order of creation.
+      std::vector<state_name_t> dense_names_;
+      /// The corresponding result states.
+      std::vector<state_t> dense_states_;
+      /// Open addressing table: indexes in dense_names_, or -1.
+      std::vector<unsigned> dense_table_;
+      /// Log2 of the size of dense_table_.
+      unsigned dense_bits_ = 0;
+
       /// Fill the worklist with the initial source-state pairs, as
       /// needed for the conjunction algorithm.
       void initialize_conjunction()
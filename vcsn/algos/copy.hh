@@ -1,6 +1,8 @@
 #pragma once
 
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include <vcsn/algos/fwd.hh> // focus_automaton.
 #include <vcsn/core/automaton-decorator.hh>
@@ -14,6 +16,7 @@
 #include <vcsn/dyn/value.hh>
 #include <vcsn/misc/attributes.hh>
 #include <vcsn/misc/set.hh>
+#include <vcsn/misc/type_traits.hh> // detect
 #include <vcsn/misc/unordered_set.hh>
 
 namespace vcsn
@@ -163,6 +166,7 @@ namespace vcsn
         // Copy the states.  We cannot iterate on the transitions
         // only, as we would lose the states without transitions.  And
         // this way, we keep the states in the same order.
+        reserve_(has_bulk_t{});
         for (auto s: in_->states())
           if (keep_state(s))
             out_state_[s] = out_->new_state();
@@ -178,10 +182,12 @@ namespace vcsn
                     out_->new_transition_copy(src->second, dst->second,
                                               in_, t);
                   else
-                    out_->add_transition_copy(src->second, dst->second,
-                                              in_, t);
+                    add_transition_copy_(src->second, dst->second, t,
+                                         has_bulk_t{});
                 }
             }
+        if (!safe_)
+          finalize_(has_bulk_t{});
       }
 
       /// Copy some transitions, and their corresponding states.
@@ -228,6 +234,66 @@ namespace vcsn
       }
 
     private:
+      template <typename Aut>
+      using finalize_mem_fn_t = decltype(std::declval<Aut&>()->finalize());
+      /// Whether the output automaton supports bulk insertion.
+      using has_bulk_t = detect<out_automaton_t, finalize_mem_fn_t>;
+
+      /// Transitions to insert in bulk: (src, dst, label, weight).
+      using pending_t
+        = std::vector<std::tuple<out_state_t, out_state_t,
+                                 label_t_of<out_automaton_t>,
+                                 weight_t_of<out_automaton_t>>>;
+
+      /// Prepare room for the copy of all of in_.
+      void reserve_(std::true_type)
+      {
+        out_->reserve_states(out_->num_states() + in_->num_states());
+        auto num_all_transitions = [](const auto& a)
+          {
+            return a->num_transitions() + a->num_initials() + a->num_finals();
+          };
+        out_->reserve_transitions(num_all_transitions(out_)
+                                  + num_all_transitions(in_));
+      }
+
+      void reserve_(std::false_type)
+      {}
+
+      /// Copy \a t from \a src to \a dst, possibly merging with an
+      /// existing transition.  Delayed until finalize_.
+      void add_transition_copy_(out_state_t src, out_state_t dst,
+                                transition_t_of<in_automaton_t> t,
+                                std::true_type)
+      {
+        pending_.emplace_back(src, dst,
+                              out_->labelset()->conv(*in_->labelset(),
+                                                     in_->label_of(t)),
+                              out_->weightset()->conv(*in_->weightset(),
+                                                      in_->weight_of(t)));
+      }
+
+      void add_transition_copy_(out_state_t src, out_state_t dst,
+                                transition_t_of<in_automaton_t> t,
+                                std::false_type)
+      {
+        out_->add_transition_copy(src, dst, in_, t);
+      }
+
+      /// Insert the pending transitions, and merge the duplicates.
+      void finalize_(std::true_type)
+      {
+        out_->new_transitions_unchecked(pending_);
+        out_->finalize();
+        pending_.clear();
+      }
+
+      void finalize_(std::false_type)
+      {}
+
+      /// Transitions waiting to be inserted.
+      pending_t pending_;
+
       /// The out state corresponding to the in-state \a s.
       /// If unknown, allocate it.
       out_state_t state(const in_state_t& s)
@@ -7,10 +7,12 @@
 #include <vcsn/core/automaton.hh>
 #include <vcsn/core/automaton-decorator.hh> // all_out
 #include <vcsn/core/polystate-automaton.hh>
+#include <vcsn/core/property-cache.hh>
 #include <vcsn/ctx/traits.hh>
 #include <vcsn/dyn/automaton.hh> // dyn::make_automaton
 #include <vcsn/dyn/fwd.hh>
 #include <vcsn/misc/getargs.hh>
+#include <vcsn/misc/parallel.hh>
 #include <vcsn/misc/raise.hh>
 #include <vcsn/weightset/polynomialset.hh>
 
@@ -64,6 +66,7 @@ namespace vcsn
       {
         return aut_->origins();
       }
+      using super_t::properties;
 
       /// Build the determinizer.
       /// \param a         the automaton to determinize
@@ -108,6 +111,128 @@ namespace vcsn
           }
       }
 
+      /// Determinize the automaton, using \a num_threads threads (0
+      /// for as many as supported by the hardware).
+      ///
+      /// The subsets are explored level by level (breadth first).  The
+      /// successors of the states of a level are computed
+      /// concurrently, and looked up in the table of state names,
+      /// which is read-only during this phase.  Then the new states
+      /// are numbered and the transitions created sequentially, in the
+      /// order of the level: the result is exactly the automaton built
+      /// by operator().
+      template <wet_kind_t K = kind>
+      auto parallel(unsigned num_threads)
+        -> std::enable_if_t<K == wet_kind_t::bitset>
+      {
+        static_assert(std::is_same<weight_t_of<Aut>, bool>::value,
+                      "determinize: parallel: requires B or F2 weights");
+        static_assert(!Lazy, "determinize: parallel: cannot be lazy");
+
+        // The outgoing transitions of the input states, sorted by
+        // label.  Read-only once built.
+        using succs_t = std::vector<std::pair<label_t, state_t>>;
+        auto succs = std::vector<succs_t>(aut_->state_size_);
+        for (auto s: aut_->input_->all_states())
+          {
+            auto& ss = succs[s];
+            for (auto t : out(aut_->input_, s))
+              ss.emplace_back(aut_->input_->label_of(t),
+                              aut_->input_->dst_of(t));
+            const auto& ls = *aut_->input_->labelset();
+            std::stable_sort(begin(ss), end(ss),
+                             [&ls](const auto& l, const auto& r)
+                             {
+                               return ls.less(l.first, r.first);
+                             });
+          }
+
+        /// A destination state: its label, and either its number, or,
+        /// if it is new, its name.
+        struct dest_t
+        {
+          label_t label;
+          state_t state;
+          state_name_t name;
+        };
+        /// The outgoing transitions and final weight of a state.
+        struct result_t
+        {
+          std::vector<dest_t> dests;
+          weight_t final;
+        };
+
+        auto level = std::vector<std::pair<state_t, const state_name_t*>>{};
+        auto results = std::vector<result_t>{};
+        while (!aut_->todo_.empty())
+          {
+            level.clear();
+            for (; !aut_->todo_.empty(); aut_->todo_.pop())
+              level.emplace_back(aut_->state(aut_->todo_.front()),
+                                 &aut_->state_name(aut_->todo_.front()));
+            results.resize(level.size());
+
+            detail::parallel_for(level.size(), num_threads,
+                                 [&](size_t i)
+              {
+                using dests_t
+                  = std::map<label_t, state_name_t, vcsn::less<labelset_t>>;
+                auto dests = dests_t{};
+                const auto& ls = *aut_->input_->labelset();
+                const auto& ss = *level[i].second;
+                for (const auto& p : ss)
+                  {
+                    // As in complete_: the destinations of each input
+                    // state, per label, are added to dests with
+                    // add_here, which is not an "or" on F2.
+                    const auto& succ = succs[label_of(p)];
+                    for (auto t = begin(succ); t != end(succ);)
+                      {
+                        const auto l = t->first;
+                        auto d = aut_->zero();
+                        for (; t != end(succ) && ls.equal(t->first, l); ++t)
+                          aut_->ns_.new_weight(d, t->second,
+                                               aut_->ws_.one());
+                        auto j = dests.find(l);
+                        if (j == dests.end())
+                          dests.emplace(l, std::move(d));
+                        else
+                          aut_->ns_.add_here(j->second, d);
+                      }
+                  }
+
+                auto& res = results[i];
+                res.dests.clear();
+                for (auto& d : dests)
+                  // Don't create transitions to the empty state.
+                  if (!aut_->ns_.is_zero(d.second))
+                    {
+                      auto k = aut_->find_key(d.second);
+                      if (k == aut_->end_key())
+                        res.dests.push_back({d.first, aut_->null_state(),
+                                             std::move(d.second)});
+                      else
+                        res.dests.push_back({d.first, aut_->state(k),
+                                             state_name_t{}});
+                    }
+                res.final = aut_->ns_.scalar_product(ss, finals_);
+              }, 16);
+
+            for (size_t i = 0; i < level.size(); ++i)
+              {
+                auto src = level[i].first;
+                for (auto& d : results[i].dests)
+                  this->new_transition(src,
+                                       d.state == aut_->null_state()
+                                       ? aut_->state_(std::move(d.name))
+                                       : d.state,
+                                       d.label);
+                if (!aut_->ws_.is_zero(results[i].final))
+                  this->set_final(src, results[i].final);
+              }
+          }
+      }
+
       /// All the outgoing transitions.
       auto all_out(state_t s) const
         -> decltype(all_out(aut_, s))
@@ -253,7 +378,27 @@ namespace vcsn
     auto res = make_shared_ptr<determinized_automaton<Aut, kind, Lazy>>(a);
     // Determinize.
     if (!Lazy)
-      res->operator()();
+      {
+        res->operator()();
+        set_property(res, property::deterministic);
+        set_property(res, property::accessible);
+      }
+    return res;
+  }
+
+  /// Boolean determinization, using \a num_threads threads (0 for
+  /// as many as supported by the hardware).
+  ///
+  /// Builds the same automaton as `determinize(a, boolean_tag{})`.
+  template <Automaton Aut>
+  auto
+  determinize_parallel(const Aut& a, unsigned num_threads = 0)
+  {
+    using res_t = determinized_automaton<Aut, wet_kind_t::bitset>;
+    auto res = make_shared_ptr<res_t>(a);
+    res->parallel(num_threads);
+    set_property(res, property::deterministic);
+    set_property(res, property::accessible);
     return res;
   }
 
@@ -309,6 +454,13 @@ namespace vcsn
         return ::vcsn::determinize(aut, Tag{}, bool_constant<Lazy>{});
       }
 
+      /// Helper function to facilitate dispatch below.
+      template <Automaton Aut>
+      automaton determinize_parallel_(const Aut& aut)
+      {
+        return ::vcsn::determinize_parallel(aut);
+      }
+
       /// Boolean Bridge.
       template <Automaton Aut, typename String>
       enable_if_boolean_t<Aut, automaton>
@@ -320,6 +472,7 @@ namespace vcsn
             {
               {"auto",          determinize_tag_<Aut, auto_tag>},
               {"boolean",       determinize_tag_<Aut, boolean_tag>},
+              {"parallel",      determinize_parallel_<Aut>},
               {"weighted",      determinize_tag_<Aut, weighted_tag>},
               {"lazy",          "lazy,auto"},
               {"lazy,auto",     "lazy,weighted"},
@@ -348,6 +501,9 @@ namespace vcsn
         if (algo == "boolean")
           raise("determinize: cannot apply Boolean"
                 " determinization to weighted automata");
+        if (algo == "parallel")
+          raise("determinize: cannot apply parallel"
+                " determinization to weighted automata");
         return map[algo](aut->as<Aut>());
       }
 
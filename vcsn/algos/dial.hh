@@ -0,0 +1,243 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <vcsn/core/automaton.hh> // states_size
+#include <vcsn/misc/radix-heap.hh>
+#include <vcsn/misc/raise.hh>
+#include <vcsn/misc/type_traits.hh> // bool_constant
+#include <vcsn/weightset/weightset.hh> // is_tropical
+
+namespace vcsn
+{
+  /*------------------------------------------------------.
+  | Shortest path with integer keys: Dial and radix heap.  |
+  `------------------------------------------------------*/
+
+  /// Dial implementation (from vcsn/algos/dial.hh).
+  ///
+  /// Dijkstra's algorithm with a circular array of buckets, one per
+  /// distance modulo the largest weight.  Requires nonnegative
+  /// integral weights, and is best suited for small ones.
+  struct dial_tag {};
+
+  /// Radix heap implementation (from vcsn/algos/dial.hh).
+  ///
+  /// Dijkstra's algorithm with a radix heap.  Requires nonnegative
+  /// integral weights.
+  struct radix_heap_tag {};
+
+  namespace detail
+  {
+    /// Whether the weights are tropical integers (nmin, zmin).
+    template <typename WeightSet>
+    struct is_integral_tropical
+      : bool_constant<is_tropical<WeightSet>::value
+                      && std::is_integral<typename WeightSet::value_t>::value>
+    {};
+
+    /// Whether the weights are nonnegative tropical integers (nmin).
+    template <typename WeightSet>
+    struct is_unsigned_tropical
+      : bool_constant<is_integral_tropical<WeightSet>::value
+                      && std::is_unsigned<typename WeightSet::value_t>::value>
+    {};
+
+    /// The distances.
+    using integral_distance_t = std::uint64_t;
+
+    /// Whether \a v is negative.
+    template <typename Value>
+    bool is_negative_(Value v, std::true_type)
+    {
+      return v < 0;
+    }
+
+    template <typename Value>
+    bool is_negative_(Value, std::false_type)
+    {
+      return false;
+    }
+
+    /// The largest weight of the transitions of \a aut.
+    ///
+    /// \throws std::runtime_error if a weight is negative.
+    template <Automaton Aut>
+    integral_distance_t
+    max_integral_weight(const Aut& aut, const char* algo)
+    {
+      using weight_t = weight_t_of<Aut>;
+      const auto& ws = *aut->weightset();
+      auto res = integral_distance_t{0};
+      for (auto t: all_transitions(aut))
+        {
+          auto w = aut->weight_of(t);
+          if (!ws.is_zero(w))
+            {
+              require(!is_negative_(w, std::is_signed<weight_t>{}),
+                      "lightest-path: ", algo, ": negative weight: ", w);
+              res = std::max(res, integral_distance_t(w));
+            }
+        }
+      return res;
+    }
+
+    /// A monotone priority queue with a circular array of buckets.
+    ///
+    /// Works if the keys in the queue are all between the last key
+    /// popped and that key plus \a max_key.
+    template <typename Value>
+    class bucket_queue
+    {
+    public:
+      using key_t = integral_distance_t;
+      using value_t = Value;
+      using elt_t = std::pair<key_t, value_t>;
+
+      bucket_queue(key_t max_key)
+        : buckets_(max_key + 1)
+      {}
+
+      bool empty() const
+      {
+        return !size_;
+      }
+
+      void emplace(key_t k, value_t v)
+      {
+        assert(last_ <= k && k <= last_ + buckets_.size() - 1);
+        buckets_[k % buckets_.size()].emplace_back(k, v);
+        ++size_;
+      }
+
+      elt_t pop()
+      {
+        assert(!empty());
+        while (buckets_[last_ % buckets_.size()].empty())
+          ++last_;
+        auto& b = buckets_[last_ % buckets_.size()];
+        auto res = b.back();
+        b.pop_back();
+        --size_;
+        return res;
+      }
+
+    private:
+      std::vector<std::vector<elt_t>> buckets_;
+      key_t last_ = 0;
+      size_t size_ = 0;
+    };
+
+    /// Dijkstra's algorithm with integral distances and a monotone
+    /// priority queue.
+    ///
+    /// A state may be in the queue several times: the entries with
+    /// an outdated distance are skipped.
+    template <Automaton Aut, typename Queue>
+    predecessors_t_of<Aut>
+    integral_dijkstra(const Aut& aut,
+                      state_t_of<Aut> source, state_t_of<Aut> dest,
+                      Queue& todo)
+    {
+      const auto& ws = *aut->weightset();
+      auto size = states_size(aut);
+      auto res = predecessors_t_of<Aut>(size, aut->null_transition());
+      auto dist
+        = std::vector<integral_distance_t>
+        (size, std::numeric_limits<integral_distance_t>::max());
+
+      dist[source] = 0;
+      todo.emplace(0, source);
+      while (!todo.empty())
+        {
+          auto p = todo.pop();
+          auto s = p.second;
+          if (dist[s] < p.first)
+            continue;
+          if (s == dest)
+            break;
+          for (auto t: all_out(aut, s))
+            {
+              auto w = aut->weight_of(t);
+              if (ws.is_zero(w))
+                continue;
+              auto dst = aut->dst_of(t);
+              auto d = p.first + integral_distance_t(w);
+              if (d < dist[dst])
+                {
+                  dist[dst] = d;
+                  res[dst] = t;
+                  todo.emplace(d, dst);
+                }
+            }
+        }
+      return res;
+    }
+
+    template <Automaton Aut>
+    predecessors_t_of<Aut>
+    dial(const Aut& aut, state_t_of<Aut> source, state_t_of<Aut> dest,
+         std::true_type)
+    {
+      auto max = max_integral_weight(aut, "dial");
+      require(max < (integral_distance_t{1} << 24),
+              "lightest-path: dial: weights are too large: ", max,
+              ", use radix-heap");
+      auto todo = bucket_queue<state_t_of<Aut>>(max);
+      return integral_dijkstra(aut, source, dest, todo);
+    }
+
+    template <Automaton Aut>
+    predecessors_t_of<Aut>
+    dial(const Aut& aut, state_t_of<Aut>, state_t_of<Aut>, std::false_type)
+    {
+      raise("lightest-path: dial: invalid weightset: ", *aut->weightset());
+    }
+
+    template <Automaton Aut>
+    predecessors_t_of<Aut>
+    radix_heap_dijkstra(const Aut& aut,
+                        state_t_of<Aut> source, state_t_of<Aut> dest,
+                        std::true_type)
+    {
+      if (!is_unsigned_tropical<weightset_t_of<Aut>>::value)
+        max_integral_weight(aut, "radix-heap");
+      auto todo = radix_heap<integral_distance_t, state_t_of<Aut>>{};
+      return integral_dijkstra(aut, source, dest, todo);
+    }
+
+    template <Automaton Aut>
+    predecessors_t_of<Aut>
+    radix_heap_dijkstra(const Aut& aut, state_t_of<Aut>, state_t_of<Aut>,
+                        std::false_type)
+    {
+      raise("lightest-path: radix-heap: invalid weightset: ",
+            *aut->weightset());
+    }
+  }
+
+  template <Automaton Aut>
+  predecessors_t_of<Aut>
+  lightest_path(const Aut& aut, state_t_of<Aut> source, state_t_of<Aut> dest,
+                dial_tag)
+  {
+    return detail::dial
+      (aut, source, dest,
+       detail::is_integral_tropical<weightset_t_of<Aut>>{});
+  }
+
+  template <Automaton Aut>
+  predecessors_t_of<Aut>
+  lightest_path(const Aut& aut, state_t_of<Aut> source, state_t_of<Aut> dest,
+                radix_heap_tag)
+  {
+    return detail::radix_heap_dijkstra
+      (aut, source, dest,
+       detail::is_integral_tropical<weightset_t_of<Aut>>{});
+  }
+}
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 
 #include <vcsn/algos/accessible.hh> // useful_states
@@ -81,6 +82,9 @@ namespace vcsn
       }
 
     private:
+      /// The style \a style_name, merged with the styles it inherits.
+      ///
+      /// \pre get_config_mutex() is locked.
       config::value get_style(const std::string& style_name)
       {
          auto conf = get_config()["dot"]["styles"];
@@ -97,6 +101,21 @@ namespace vcsn
          return style;
       }
 
+      /// Print the attributes of \a kind ("edge" or "node") in the
+      /// default style.
+      void print_style_(const std::string& kind)
+      {
+        auto&& lock = std::lock_guard<std::mutex>{get_config_mutex()};
+        auto style_name = get_config()["dot"]["default-style"].str();
+        auto conf = get_style(style_name)[kind];
+        auto keys = conf.keys();
+        bos_ << keys[0] << " = " << conf[keys[0]].str();
+        for (size_t i = 1; i < keys.size(); i++)
+        {
+          bos_ << ", " << keys[i] << " = " << conf[keys[i]].str();
+        }
+      }
+
       /// Start the dot graph.
       void print_prologue_()
       {
@@ -114,16 +133,7 @@ namespace vcsn
         if (dot2tex_)
           bos_ << "texmode = math, lblstyle = auto";
         else
-        {
-          auto style_name = get_config()["dot"]["default-style"].str();
-          auto conf = get_style(style_name)["edge"];
-          auto keys = conf.keys();
-          bos_ << keys[0] << " = " << conf[keys[0]].str();
-          for (size_t i = 1; i < keys.size(); i++)
-          {
-            bos_ << ", " << keys[i] << " = " << conf[keys[i]].str();
-          }
-        }
+          print_style_("edge");
         bos_  << "]\n" << std::flush;
 
         if (dot2tex_)
@@ -314,16 +324,7 @@ namespace vcsn
             if (dot2tex_)
               bos_ << "texmode = math, style = state";
             else
-            {
-              auto style_name = get_config()["dot"]["default-style"].str();
-              auto conf = get_style(style_name)["node"];
-              auto keys = conf.keys();
-              bos_ << keys[0] << " = " << conf[keys[0]].str();
-              for (size_t i = 1; i < keys.size(); i++)
-              {
-                bos_ << ", " << keys[i] << " = " << conf[keys[i]].str();
-              }
-            }
+              print_style_("node");
             bos_  << "]\n";
             for (auto s : aut_->states())
               {
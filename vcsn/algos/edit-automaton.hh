@@ -136,13 +136,13 @@ namespace vcsn
     void
     add_initial(string_t s, string_t weight = string_t{}) override final
     {
-      res_->add_initial(state_(s), weight_(weight));
+      add_(res_->pre(), state_(s), res_->prepost_label(), weight_(weight));
     }
 
     void
     add_final(string_t s, string_t weight = string_t{}) override final
     {
-      res_->add_final(state_(s), weight_(weight));
+      add_(state_(s), res_->post(), res_->prepost_label(), weight_(weight));
     }
 
     void
@@ -156,7 +156,7 @@ namespace vcsn
       // evaluation.
       auto s = state_(src);
       auto d = state_(dst);
-      res_->add_transition(s, d, label_(label), weight_(weight));
+      add_(s, d, label_(label), weight_(weight));
     }
 
     /// Add transitions from \a src to \a dst, labeled by \a entry.
@@ -172,7 +172,7 @@ namespace vcsn
       if (s == res_->pre() || d == res_->post())
         {
           if (entry.get().empty())
-            res_->add_transition(s, d, res_->prepost_label());
+            add_(s, d, res_->prepost_label(), res_->weightset()->one());
           else
             {
               using std::begin;
@@ -185,8 +185,7 @@ namespace vcsn
                            "edit_automaton: invalid ",
                            s == res_->pre() ? "initial" : "final",
                            " entry: ", entry.get());
-              res_->add_transition(s, d,
-                                   res_->prepost_label(), weight_of(m));
+              add_(s, d, res_->prepost_label(), weight_of(m));
             }
         }
       else
@@ -199,18 +198,16 @@ namespace vcsn
               detail::static_if<labelset_t::has_one()>
                 ([&](const auto& ls)
                  {
-                   res_->add_transition
-                     (s, d,
-                      ls.is_special(label_of(m)) ? ls.one() : label_of(m),
-                      weight_of(m));
+                   add_(s, d,
+                        ls.is_special(label_of(m)) ? ls.one() : label_of(m),
+                        weight_of(m));
                  },
                  [&](const auto& ls)
                  {
                    VCSN_REQUIRE(!ls.is_special(label_of(m)),
                                 "edit_automaton: invalid entry: ",
                                 entry.get());
-                   res_->add_transition(s, d,
-                                        label_of(m), weight_of(m));
+                   add_(s, d, label_of(m), weight_of(m));
                  })
                 (ls);
             }
@@ -222,6 +219,9 @@ namespace vcsn
     result() override final
     {
       const_cast<labelset_t&>(*res_->context().labelset()).open(false);
+      res_->new_transitions_unchecked(transitions_);
+      res_->finalize();
+      transitions_.clear();
       return res_;
     }
 
@@ -230,9 +230,17 @@ namespace vcsn
     reset() override final
     {
       res_ = nullptr;
+      transitions_.clear();
     }
 
   private:
+    /// Record a transition, merged with its duplicates by result().
+    void
+    add_(state_t s, state_t d, label_t l, weight_t w)
+    {
+      transitions_.emplace_back(s, d, l, w);
+    }
+
     /// Convert a label string to its value.
     label_t
     label_(string_t l)
@@ -266,6 +274,9 @@ namespace vcsn
     automaton_t res_;
     /// Entries handler.
     polynomialset<context_t> ps_;
+    /// The transitions (including initial and final ones), inserted
+    /// in bulk by result().
+    std::vector<std::tuple<state_t, state_t, label_t, weight_t>> transitions_;
 
     /// Memoize entry conversion.
     using entry_map = std::unordered_map<string_t, entry_t>;
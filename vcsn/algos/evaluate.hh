@@ -1,18 +1,30 @@
 #pragma once
 
-#include <vector>
+#include <algorithm>
+#include <functional>
+#include <numeric>
 #include <queue>
+#include <tuple>
+#include <vector>
 
 #include <vcsn/algos/is-proper.hh>
 #include <vcsn/core/automaton.hh> // out
 #include <vcsn/ctx/traits.hh>
+#include <vcsn/dyn/algos.hh> // get_format
 #include <vcsn/dyn/automaton.hh>
 #include <vcsn/dyn/fwd.hh>
 #include <vcsn/dyn/value.hh>
 #include <vcsn/labelset/labelset.hh>
 #include <vcsn/labelset/word-polynomialset.hh>
 #include <vcsn/misc/algorithm.hh>
+#include <vcsn/misc/builtins.hh>
+#include <vcsn/misc/format.hh>
+#include <vcsn/misc/mapped-file.hh>
+#include <vcsn/misc/parallel.hh>
+#include <vcsn/misc/stream.hh> // conv
+#include <vcsn/misc/static-if.hh>
 #include <vcsn/misc/type_traits.hh>
+#include <vcsn/weightset/fwd.hh> // b
 
 namespace vcsn
 {
@@ -33,10 +45,12 @@ namespace vcsn
       using weightset_t = weightset_t_of<automaton_t>;
       using weight_t = typename weightset_t::value_t;
 
+    public:
       /// state -> weight.
       using weights_t = std::vector<weight_t>;
+      /// The type of the sets of active states.
+      using state_set_t = weights_t;
 
-    public:
       evaluator(const automaton_t& a)
         : aut_(a)
       {}
@@ -95,54 +109,63 @@ namespace vcsn
                       weight_t>
       operator()(const word_t& word) const
       {
-        // An array indexed by state numbers.
-        //
-        // Do not use braces (v1{size, ws_.zero()}): the type of zero
-        // might result in the compiler believing we are building a
-        // vector with two values: size and zero.
-        //
-        // We start with just two states numbered 0 and 1: pre() and
-        // post().
-        auto v1 = weights_t(2, ws_.zero());
-        v1.reserve(states_size(aut_));
-        v1[aut_->pre()] = ws_.one();
+        auto v1 = pre_();
         auto v2 = v1;
-        v2.reserve(states_size(aut_));
-
-        // Computation.
+        v2.reserve(v1.capacity());
         for (const auto l : ls_.letters_of(ls_.delimit(word)))
           {
-            v2.assign(v2.size(), ws_.zero());
-            for (size_t s = 0; s < v1.size(); ++s)
-              if (!ws_.is_zero(v1[s])) // delete if bench >
-                for (const auto t : out(aut_, s, l))
-                  {
-                    const auto dst = aut_->dst_of(t);
-                    // Make sure the vectors are large enough for dst.
-                    // Exponential growth on the capacity, but keep
-                    // the actual size as small as possible.
-                    if (v2.size() <= dst)
-                      {
-                        auto capacity = v2.capacity();
-                        while (capacity <= dst)
-                          capacity *= 2;
-                        v1.reserve(capacity);
-                        v2.reserve(capacity);
-                        v1.resize(dst + 1, ws_.zero());
-                        v2.resize(dst + 1, ws_.zero());
-                      }
-                    // Introducing a reference to v2[dst] is tempting,
-                    // but won't work for std::vector<bool>.  FIXME:
-                    // Specialize for Boolean?  Or introduce add_here.
-                    v2[dst] =
-                      ws_.add(v2[dst],
-                              ws_.mul(v1[s], aut_->weight_of(t)));
-                  }
+            step_(v1, l, v2);
             std::swap(v1, v2);
           }
         return v1[aut_->post()];
       }
 
+      /// The weights of the states once the initial transitions are
+      /// taken.
+      template <typename LabelSet = labelset_t>
+      std::enable_if_t<LabelSet::is_free(),
+                      state_set_t>
+      start() const
+      {
+        auto v1 = pre_();
+        auto res = v1;
+        res.reserve(v1.capacity());
+        step_(v1, ls_.special(), res);
+        return res;
+      }
+
+      /// Read letter \a l from the weights in \a v1, into \a v2.
+      ///
+      /// \returns  whether some transition was taken.
+      template <typename LabelSet = labelset_t>
+      std::enable_if_t<LabelSet::is_free(), bool>
+      step(state_set_t& v1, const typename LabelSet::value_t& l,
+           state_set_t& v2) const
+      {
+        return step_(v1, l, v2);
+      }
+
+      /// Add the weights of \a v2 to those of \a v1.
+      void add(state_set_t& v1, const state_set_t& v2) const
+      {
+        if (v1.size() < v2.size())
+          v1.resize(v2.size(), ws_.zero());
+        for (size_t s = 0; s < v2.size(); ++s)
+          if (!ws_.is_zero(v2[s]))
+            v1[s] = ws_.add(v1[s], v2[s]);
+      }
+
+      /// The weight of the end of the word, given the weights in \a
+      /// v1, using \a v2 as a buffer.
+      template <typename LabelSet = labelset_t>
+      std::enable_if_t<LabelSet::is_free(),
+                      weight_t>
+      finish(state_set_t& v1, state_set_t& v2) const
+      {
+        step_(v1, ls_.special(), v2);
+        return v2[aut_->post()];
+      }
+
       /// Polynomial implementation.
       weight_t operator()(const polynomial_t& poly) const
       {
@@ -167,6 +190,60 @@ namespace vcsn
       }
 
     private:
+      /// The weights of the states before reading anything.
+      weights_t pre_() const
+      {
+        // An array indexed by state numbers.
+        //
+        // Do not use braces (v1{size, ws_.zero()}): the type of zero
+        // might result in the compiler believing we are building a
+        // vector with two values: size and zero.
+        //
+        // We start with just two states numbered 0 and 1: pre() and
+        // post().
+        auto res = weights_t(2, ws_.zero());
+        res.reserve(states_size(aut_));
+        res[aut_->pre()] = ws_.one();
+        return res;
+      }
+
+      /// Read letter \a l from the weights in \a v1, into \a v2.
+      ///
+      /// \returns  whether some transition was taken.
+      template <typename Label>
+      bool step_(weights_t& v1, const Label& l, weights_t& v2) const
+      {
+        auto res = false;
+        v2.assign(v1.size(), ws_.zero());
+        for (size_t s = 0; s < v1.size(); ++s)
+          if (!ws_.is_zero(v1[s])) // delete if bench >
+            for (const auto t : out(aut_, s, l))
+              {
+                res = true;
+                const auto dst = aut_->dst_of(t);
+                // Make sure the vectors are large enough for dst.
+                // Exponential growth on the capacity, but keep the
+                // actual size as small as possible.
+                if (v2.size() <= dst)
+                  {
+                    auto capacity = std::max(v2.capacity(), size_t{1});
+                    while (capacity <= dst)
+                      capacity *= 2;
+                    v1.reserve(capacity);
+                    v2.reserve(capacity);
+                    v1.resize(dst + 1, ws_.zero());
+                    v2.resize(dst + 1, ws_.zero());
+                  }
+                // Introducing a reference to v2[dst] is tempting, but
+                // won't work for std::vector<bool>.  FIXME:
+                // Specialize for Boolean?  Or introduce add_here.
+                v2[dst] =
+                  ws_.add(v2[dst],
+                          ws_.mul(v1[s], aut_->weight_of(t)));
+              }
+        return res;
+      }
+
       automaton_t aut_;
       const weightset_t& ws_ = *aut_->weightset();
       const labelset_t& ls_ = *aut_->labelset();
@@ -174,9 +251,245 @@ namespace vcsn
       const wps_t wps_ = make_word_polynomialset(aut_->context());
     };
 
+
+    /// Whether \a Aut is a Boolean automaton labeled by letters.
+    template <Automaton Aut>
+    constexpr bool is_boolean_lal()
+    {
+      return (context_t_of<Aut>::is_lal
+              && labelset_t_of<Aut>::is_free()
+              && std::is_same<weightset_t_of<Aut>, b>::value);
+    }
+
+    /// Whether some states of \a aut are not explored yet.
+    template <Automaton Aut>
+    bool has_lazy_states(const Aut& aut)
+    {
+      return any_of(aut->all_states(),
+                    [&aut](state_t_of<Aut> s)
+                    {
+                      return aut->is_lazy(s);
+                    });
+    }
+
+    /// Evaluate words on a Boolean automaton labeled by letters.
+    ///
+    /// The accessible part of the automaton is compiled into a table
+    /// of successors indexed by (state, letter), and the set of
+    /// active states is a bitset packed in words.  Each letter then
+    /// costs a walk on the active states, with no weight computation
+    /// at all.
+    ///
+    /// The compilation costs O(|Q|.|A| + |E|), and explores lazy
+    /// automata completely: it pays off only when many letters are
+    /// read, and not on lazy automata.
+    template <Automaton Aut>
+    class bool_evaluator
+    {
+      static_assert(is_boolean_lal<Aut>(),
+                    "bool_evaluator: requires a Boolean lal automaton");
+
+      using automaton_t = Aut;
+      using labelset_t = labelset_t_of<automaton_t>;
+      using label_t = label_t_of<automaton_t>;
+      using state_t = state_t_of<automaton_t>;
+      using word_t = word_t_of<automaton_t>;
+
+    public:
+      bool_evaluator(const automaton_t& aut)
+        : ls_(*aut->labelset())
+      {
+        // Number the accessible states in order of discovery, and
+        // gather their transitions.
+        constexpr auto none = -1U;
+        auto states = std::vector<state_t>{};
+        auto id_of = std::vector<unsigned>{};
+        auto id = [&](state_t s)
+          {
+            if (id_of.size() <= s)
+              id_of.resize(s + 1, none);
+            if (id_of[s] == none)
+              {
+                id_of[s] = states.size();
+                states.emplace_back(s);
+              }
+            return id_of[s];
+          };
+        auto initials = std::vector<unsigned>{};
+        for (auto t: all_out(aut, aut->pre()))
+          initials.emplace_back(id(aut->dst_of(t)));
+        auto finals = std::vector<unsigned>{};
+        // (source, label, destination).
+        auto transitions
+          = std::vector<std::tuple<unsigned, label_t, unsigned>>{};
+        for (unsigned s = 0; s < states.size(); ++s)
+          for (auto t: all_out(aut, states[s]))
+            if (aut->dst_of(t) == aut->post())
+              finals.emplace_back(s);
+            else
+              transitions.emplace_back(s, aut->label_of(t),
+                                       id(aut->dst_of(t)));
+
+        // The letters actually used.
+        for (const auto& t: transitions)
+          letters_.emplace_back(std::get<1>(t));
+        std::sort(begin(letters_), end(letters_),
+                  [this](const label_t& l, const label_t& r)
+                  {
+                    return ls_.less(l, r);
+                  });
+        letters_.erase(std::unique(begin(letters_), end(letters_),
+                                   [this](const label_t& l, const label_t& r)
+                                   {
+                                     return ls_.equal(l, r);
+                                   }),
+                       end(letters_));
+
+        // The successor table, with a counting sort on (state, letter).
+        num_states_ = states.size();
+        const auto size = num_states_ * letters_.size();
+        offsets_.assign(size + 1, 0);
+        auto index = [this](const auto& t)
+          {
+            return index_(std::get<0>(t), letter_index_(std::get<1>(t)));
+          };
+        for (const auto& t: transitions)
+          ++offsets_[index(t) + 1];
+        std::partial_sum(begin(offsets_), end(offsets_), begin(offsets_));
+        dsts_.resize(transitions.size());
+        auto pos = std::vector<unsigned>(begin(offsets_), end(offsets_) - 1);
+        for (const auto& t: transitions)
+          dsts_[pos[index(t)]++] = std::get<2>(t);
+
+        initials_ = make_bitset_(initials);
+        finals_ = make_bitset_(finals);
+      }
+
+    private:
+      /// Sets of states, packed in words.
+      using block_t = unsigned long long;
+      using bitset_t = std::vector<block_t>;
+      static constexpr size_t block_bits = 8 * sizeof(block_t);
+
+    public:
+      /// The type of the sets of active states.
+      using state_set_t = bitset_t;
+
+      /// Whether \a word is accepted.
+      bool operator()(const word_t& word) const
+      {
+        auto cur = start();
+        auto next = bitset_t(cur.size());
+        for (const auto l: ls_.letters_of(word))
+          if (!step(cur, l, next))
+            return false;
+          else
+            std::swap(cur, next);
+        return finish(cur, next);
+      }
+
+      /// The initial states.
+      state_set_t start() const
+      {
+        return initials_;
+      }
+
+      /// Read letter \a l from the states \a cur, into \a next.
+      ///
+      /// \returns  whether \a next is not empty.
+      bool step(const state_set_t& cur, const label_t& l,
+                state_set_t& next) const
+      {
+        next.assign(cur.size(), 0);
+        const auto li = letter_index_(l);
+        if (li == letters_.size())
+          return false;
+        auto live = false;
+        for (size_t b = 0; b < cur.size(); ++b)
+          for (auto bits = cur[b]; bits; bits &= bits - 1)
+            {
+              const auto s = b * block_bits + BUILTIN_CTZLL(bits);
+              const auto i = index_(s, li);
+              for (auto j = offsets_[i]; j < offsets_[i + 1]; ++j)
+                {
+                  next[dsts_[j] / block_bits]
+                    |= block_t{1} << (dsts_[j] % block_bits);
+                  live = true;
+                }
+            }
+        return live;
+      }
+
+      /// Add the states of \a ss to \a cur.
+      void add(state_set_t& cur, const state_set_t& ss) const
+      {
+        for (size_t b = 0; b < cur.size(); ++b)
+          cur[b] |= ss[b];
+      }
+
+      /// Whether \a cur contains a final state.
+      bool finish(const state_set_t& cur, state_set_t&) const
+      {
+        for (size_t b = 0; b < cur.size(); ++b)
+          if (cur[b] & finals_[b])
+            return true;
+        return false;
+      }
+
+    private:
+
+      /// The set of states \a ss.
+      bitset_t make_bitset_(const std::vector<unsigned>& ss) const
+      {
+        auto res = bitset_t((num_states_ + block_bits - 1) / block_bits);
+        for (auto s: ss)
+          res[s / block_bits] |= block_t{1} << (s % block_bits);
+        return res;
+      }
+
+      /// The index of the successors of state \a s on letter number
+      /// \a l in offsets_.
+      size_t index_(size_t s, size_t l) const
+      {
+        return s * letters_.size() + l;
+      }
+
+      /// The number of \a l in letters_, or letters_.size() if it is
+      /// not used.
+      size_t letter_index_(const label_t& l) const
+      {
+        auto i = std::lower_bound(begin(letters_), end(letters_), l,
+                                  [this](const label_t& l, const label_t& r)
+                                  {
+                                    return ls_.less(l, r);
+                                  });
+        if (i != end(letters_) && ls_.equal(*i, l))
+          return i - begin(letters_);
+        else
+          return letters_.size();
+      }
+
+      const labelset_t& ls_;
+      /// The labels used in the automaton, sorted.
+      std::vector<label_t> letters_;
+      /// Number of accessible states.
+      size_t num_states_;
+      /// For each (state, letter), the start of its successors in dsts_.
+      std::vector<unsigned> offsets_;
+      /// The successors.
+      std::vector<unsigned> dsts_;
+      /// The initial states.
+      bitset_t initials_;
+      /// The final states.
+      bitset_t finals_;
+    };
   } // namespace detail
 
   /// General case of evaluation.
+  ///
+  /// A single word does not pay for the compilation of a
+  /// bool_evaluator, which would also expand lazy automata: see
+  /// evaluate_batch and evaluate_stream.
   template <Automaton Aut>
   auto
   evaluate(const Aut& a, const word_t_of<Aut>& w)
@@ -274,4 +587,476 @@ namespace vcsn
       }
     }
   }
+
+
+  /*-----------------.
+  | evaluate_batch.  |
+  `-----------------*/
+
+  namespace detail
+  {
+    /// Evaluate \a words with \a eval, on (up to) \a num_threads
+    /// threads.
+    ///
+    /// The words are sorted, so that consecutive words share their
+    /// longest common prefix, and the active states after each prefix
+    /// of the current word are kept on a stack: this is a depth-first
+    /// traversal of the trie of the words, where each common prefix
+    /// is read only once.  Each thread processes a slice of the
+    /// sorted words.
+    template <typename Weight, typename Evaluator, typename LabelSet,
+              typename Word>
+    std::vector<Weight>
+    evaluate_batch_trie(const Evaluator& eval, const LabelSet& ls,
+                        const std::vector<Word>& words,
+                        unsigned num_threads)
+    {
+      using state_set_t = typename Evaluator::state_set_t;
+      using letter_t = typename LabelSet::value_t;
+      auto order = std::vector<size_t>(words.size());
+      std::iota(begin(order), end(order), 0);
+      std::sort(begin(order), end(order),
+                [&ls, &words](size_t i, size_t j)
+                {
+                  return std::lexicographical_compare
+                    (begin(words[i]), end(words[i]),
+                     begin(words[j]), end(words[j]),
+                     [&ls](const letter_t& l, const letter_t& r)
+                     {
+                       return ls.less(l, r);
+                     });
+                });
+
+      // The weights of each slice of the sorted words.
+      auto slices
+        = std::vector<std::vector<Weight>>(detail::num_threads(num_threads));
+      parallel_chunks(order.size(), num_threads,
+                      [&](size_t slice, size_t b, size_t e)
+        {
+          auto& res = slices[slice];
+          res.reserve(e - b);
+          // stack[i]: the active states after the first i letters of
+          // the current word.
+          auto stack = std::vector<state_set_t>{eval.start()};
+          auto buffer = state_set_t{};
+          const Word* prev = nullptr;
+          for (auto i = b; i < e; ++i)
+            {
+              const auto& w = words[order[i]];
+              // Skip the prefix shared with the previous word.
+              auto l = begin(w);
+              if (prev)
+                l = std::mismatch(begin(*prev), end(*prev), l, end(w),
+                                  [&ls](const letter_t& l, const letter_t& r)
+                                  {
+                                    return ls.equal(l, r);
+                                  }).second;
+              for (size_t depth = l - begin(w); l != end(w); ++l, ++depth)
+                {
+                  if (stack.size() <= depth + 1)
+                    stack.resize(depth + 2);
+                  eval.step(stack[depth], *l, stack[depth + 1]);
+                }
+              res.emplace_back(eval.finish(stack[w.size()], buffer));
+              prev = &w;
+            }
+        });
+
+      auto res = std::vector<Weight>(words.size());
+      size_t i = 0;
+      for (const auto& slice: slices)
+        for (const auto& w: slice)
+          res[order[i++]] = w;
+      return res;
+    }
+
+    /// Boolean lal automata: use the bit-parallel engine, unless the
+    /// automaton is lazy, since its compilation would explore it
+    /// completely.
+    template <Automaton Aut>
+    auto
+    evaluate_batch_(const Aut& a, const std::vector<word_t_of<Aut>>& words,
+                    unsigned num_threads)
+      -> std::enable_if_t<is_boolean_lal<Aut>(),
+                          std::vector<weight_t_of<Aut>>>
+    {
+      if (has_lazy_states(a))
+        {
+          auto eval = evaluator<Aut>{a};
+          return evaluate_batch_trie<weight_t_of<Aut>>(eval, *a->labelset(),
+                                                       words, num_threads);
+        }
+      else
+        {
+          auto eval = bool_evaluator<Aut>{a};
+          return evaluate_batch_trie<weight_t_of<Aut>>(eval, *a->labelset(),
+                                                       words, num_threads);
+        }
+    }
+
+    /// Other free labelsets: share the prefixes.
+    template <Automaton Aut>
+    auto
+    evaluate_batch_(const Aut& a, const std::vector<word_t_of<Aut>>& words,
+                    unsigned num_threads)
+      -> std::enable_if_t<!is_boolean_lal<Aut>()
+                          && labelset_t_of<Aut>::is_free(),
+                          std::vector<weight_t_of<Aut>>>
+    {
+      auto eval = evaluator<Aut>{a};
+      return evaluate_batch_trie<weight_t_of<Aut>>(eval, *a->labelset(),
+                                                   words, num_threads);
+    }
+
+    /// Non free labelsets: evaluate each word.
+    template <Automaton Aut>
+    auto
+    evaluate_batch_(const Aut& a, const std::vector<word_t_of<Aut>>& words,
+                    unsigned num_threads)
+      -> std::enable_if_t<!labelset_t_of<Aut>::is_free(),
+                          std::vector<weight_t_of<Aut>>>
+    {
+      auto eval = evaluator<Aut>{a};
+      auto slices = std::vector<std::vector<weight_t_of<Aut>>>
+        (detail::num_threads(num_threads));
+      parallel_chunks(words.size(), num_threads,
+                      [&](size_t slice, size_t b, size_t e)
+        {
+          for (auto i = b; i < e; ++i)
+            slices[slice].emplace_back(eval(words[i]));
+        });
+      auto res = std::vector<weight_t_of<Aut>>{};
+      res.reserve(words.size());
+      for (const auto& slice: slices)
+        res.insert(end(res), begin(slice), end(slice));
+      return res;
+    }
+  }
+
+  /// Evaluate several words on an automaton.
+  ///
+  /// Computations are shared between the common prefixes of the
+  /// words, when the labelset is free.
+  ///
+  /// \param aut          the automaton
+  /// \param words        the words to evaluate
+  /// \param num_threads  the number of threads to use, 0 for as many
+  ///                     as hardware threads.  Lazy automata, and
+  ///                     values that cannot be computed concurrently
+  ///                     (e.g., expressions), are always evaluated on
+  ///                     a single thread.
+  /// \returns  the weights of the words, in the same order.
+  template <Automaton Aut>
+  auto
+  evaluate_batch(const Aut& aut, const std::vector<word_t_of<Aut>>& words,
+                 unsigned num_threads = 1)
+    -> std::enable_if_t<!context_t_of<Aut>::is_lao,
+                        std::vector<weight_t_of<Aut>>>
+  {
+    // Some values (e.g., expressions) cannot be built concurrently.
+    if (!is_thread_safe<context_t_of<Aut>>{})
+      num_threads = 1;
+    // Lazy automata are completed on the fly, which is not
+    // thread-safe.
+    if (num_threads != 1 && detail::has_lazy_states(aut))
+      num_threads = 1;
+    return detail::evaluate_batch_(aut, words, num_threads);
+  }
+
+  namespace dyn
+  {
+    namespace detail
+    {
+      /// Bridge.
+      template <Automaton Aut, typename Strings, typename Unsigned>
+      std::vector<weight>
+      evaluate_batch(const automaton& aut,
+                     const std::vector<std::string>& words,
+                     unsigned num_threads)
+      {
+        using ctx_t = context_t_of<Aut>;
+        constexpr auto valid
+          = (ctx_t::is_lal || ctx_t::is_lan || ctx_t::is_lat
+             || ctx_t::is_law);
+        return vcsn::detail::static_if<valid>
+          ([&words, num_threads](const auto& a) -> std::vector<weight>
+           {
+             const auto ws = make_wordset(*a->labelset());
+             auto ls = std::vector<word_t_of<Aut>>{};
+             ls.reserve(words.size());
+             for (const auto& w: words)
+               ls.emplace_back(conv(ws, w));
+             auto res = std::vector<weight>{};
+             res.reserve(words.size());
+             for (const auto& w: ::vcsn::evaluate_batch(a, ls, num_threads))
+               res.emplace_back(*a->weightset(), w);
+             return res;
+           },
+           [](const auto& a) -> std::vector<weight>
+           {
+             raise("evaluate_batch: unsupported labelset: ",
+                   *a->labelset());
+           })
+          (aut->as<Aut>());
+      }
+    }
+  }
+
+
+  /*------------------.
+  | evaluate_stream.  |
+  `------------------*/
+
+  namespace detail
+  {
+    /// Evaluate a text fed by chunks.
+    ///
+    /// The active states are kept from one chunk to the next, so the
+    /// text may be split anywhere.  In "lines" mode, the text is a
+    /// sequence of records, ended by a separator, and the weight of
+    /// each record is reported.  In "positions" mode, the text is a
+    /// single word, and the positions where a factor with a non-zero
+    /// weight ends are reported, with the sum of the weights of these
+    /// factors.
+    ///
+    /// \tparam Evaluator  the engine: evaluator<Aut>, or, for Boolean
+    ///                    automata, bool_evaluator<Aut>.
+    template <Automaton Aut, typename Evaluator = evaluator<Aut>>
+    class stream_evaluator
+    {
+    public:
+      using automaton_t = Aut;
+      using label_t = label_t_of<automaton_t>;
+      using weightset_t = weightset_t_of<automaton_t>;
+      using weight_t = weight_t_of<automaton_t>;
+      using evaluator_t = Evaluator;
+      using state_set_t = typename evaluator_t::state_set_t;
+      /// Called with a record number (or a position), and its weight.
+      using report_t = std::function<void(size_t, const weight_t&)>;
+
+      stream_evaluator(const automaton_t& aut, bool positions,
+                       const label_t& separator, report_t report)
+        : ws_(*aut->weightset())
+        , eval_(aut)
+        , positions_(positions)
+        , separator_(separator)
+        , report_(std::move(report))
+        , start_(eval_.start())
+        , cur_(start_)
+      {
+        // The empty factor, before the first letter.
+        if (positions_)
+          report_if_(0);
+      }
+
+      /// Read the letters in [b, e).
+      template <typename InputIt>
+      void feed(InputIt b, InputIt e)
+      {
+        if (positions_)
+          for (; b != e; ++b)
+            {
+              eval_.step(cur_, *b, next_);
+              std::swap(cur_, next_);
+              // A factor may start after each letter.
+              eval_.add(cur_, start_);
+              report_if_(++position_);
+            }
+        else
+          while (b != e)
+            if (*b == separator_)
+              {
+                end_record_();
+                ++b;
+              }
+            else if (dead_)
+              // No need to read the rest of this record.
+              b = std::find(b, e, separator_);
+            else
+              {
+                pending_ = true;
+                dead_ = !eval_.step(cur_, *b, next_);
+                std::swap(cur_, next_);
+                ++b;
+              }
+      }
+
+      /// The end of the text: report the last record, if it is not
+      /// ended by a separator.
+      void finish()
+      {
+        if (!positions_ && pending_)
+          end_record_();
+      }
+
+    private:
+      /// Report the weight of the current record, and prepare for
+      /// the next one.
+      void end_record_()
+      {
+        report_(record_++, dead_ ? ws_.zero() : eval_.finish(cur_, next_));
+        cur_ = start_;
+        dead_ = pending_ = false;
+      }
+
+      /// Report \a pos if a factor with a non-zero weight ends there.
+      void report_if_(size_t pos)
+      {
+        auto w = eval_.finish(cur_, next_);
+        if (!ws_.is_zero(w))
+          report_(pos, w);
+      }
+
+      const weightset_t& ws_;
+      evaluator_t eval_;
+      /// Whether to report positions rather than records.
+      bool positions_;
+      /// The end of the records.
+      label_t separator_;
+      report_t report_;
+      /// The active states before reading anything.
+      state_set_t start_;
+      /// The active states.
+      state_set_t cur_;
+      /// A buffer for the next active states.
+      state_set_t next_;
+      /// The number of the current record.
+      size_t record_ = 0;
+      /// The number of letters read, in "positions" mode.
+      size_t position_ = 0;
+      /// Whether the current record has no active state.
+      bool dead_ = false;
+      /// Whether the current record has some letters.
+      bool pending_ = false;
+    };
+
+    /// Feed \a eval with the contents of \a is.
+    template <typename StreamEvaluator>
+    void
+    feed_stream(StreamEvaluator& eval, std::istream& is)
+    {
+      if (auto buf = dynamic_cast<memory_streambuf*>(is.rdbuf()))
+        {
+          eval.feed(buf->current(), buf->end());
+          buf->seek(buf->end());
+        }
+      else
+        {
+          auto chunk = std::vector<char>(size_t{1} << 16);
+          while (is.read(chunk.data(), chunk.size()) || is.gcount())
+            eval.feed(chunk.data(), chunk.data() + is.gcount());
+        }
+      eval.finish();
+    }
+
+    /// Boolean lal automata: use the bit-parallel engine, unless the
+    /// automaton is lazy, since its compilation would explore it
+    /// completely.
+    template <Automaton Aut>
+    auto
+    evaluate_stream_(const Aut& aut, std::istream& is, bool positions,
+                     typename stream_evaluator<Aut>::report_t report,
+                     char separator)
+      -> std::enable_if_t<is_boolean_lal<Aut>()>
+    {
+      if (has_lazy_states(aut))
+        {
+          auto eval = stream_evaluator<Aut>{aut, positions, separator,
+                                            std::move(report)};
+          feed_stream(eval, is);
+        }
+      else
+        {
+          auto eval
+            = stream_evaluator<Aut, bool_evaluator<Aut>>{aut, positions,
+                                                         separator,
+                                                         std::move(report)};
+          feed_stream(eval, is);
+        }
+    }
+
+    /// Other automata: the general evaluator.
+    template <Automaton Aut>
+    auto
+    evaluate_stream_(const Aut& aut, std::istream& is, bool positions,
+                     typename stream_evaluator<Aut>::report_t report,
+                     char separator)
+      -> std::enable_if_t<!is_boolean_lal<Aut>()>
+    {
+      auto eval = stream_evaluator<Aut>{aut, positions, separator,
+                                        std::move(report)};
+      feed_stream(eval, is);
+    }
+  }
+
+  /// Evaluate the contents of a stream.
+  ///
+  /// A stream on a memory_streambuf (e.g., a mapped file, see
+  /// open_mapped_file) is read in place, other streams are read by
+  /// chunks.
+  ///
+  /// \param aut        the automaton, labeled by characters
+  /// \param is         the text to evaluate
+  /// \param positions  whether to report the end positions of the
+  ///                   factors with a non-zero weight, rather than the
+  ///                   weight of each record
+  /// \param report     called with each record number (or position)
+  ///                   and its weight
+  /// \param separator  the end of the records
+  template <Automaton Aut>
+  void
+  evaluate_stream(const Aut& aut, std::istream& is, bool positions,
+                  typename detail::stream_evaluator<Aut>::report_t report,
+                  char separator = '\n')
+  {
+    static_assert(labelset_t_of<Aut>::is_free(),
+                  "evaluate_stream: requires a free labelset");
+    static_assert(std::is_same<label_t_of<Aut>, char>::value,
+                  "evaluate_stream: requires char labels");
+    detail::evaluate_stream_(aut, is, positions, std::move(report),
+                             separator);
+  }
+
+  namespace dyn
+  {
+    namespace detail
+    {
+      /// Bridge.
+      template <Automaton Aut, typename Istream, typename Ostream,
+                typename String>
+      void
+      evaluate_stream(const automaton& aut, std::istream& is,
+                      std::ostream& os, const std::string& mode)
+      {
+        require(mode == "lines" || mode == "positions",
+                "evaluate_stream: invalid mode: ", mode);
+        using ctx_t = context_t_of<Aut>;
+        constexpr auto valid
+          = (ctx_t::labelset_t::is_free()
+             && std::is_same<label_t_of<Aut>, char>::value);
+        vcsn::detail::static_if<valid>
+          ([&is, &os, &mode](const auto& a)
+           {
+             using weight_t = weight_t_of<std::decay_t<decltype(a)>>;
+             const auto& ws = *a->weightset();
+             const auto positions = mode == "positions";
+             const auto fmt = vcsn::format{dyn::get_format(os)};
+             ::vcsn::evaluate_stream
+               (a, is, positions,
+                [&os, &ws, positions, &fmt](size_t i, const weight_t& w)
+                {
+                  if (positions)
+                    os << i << ' ';
+                  ws.print(w, os, fmt) << '\n';
+                });
+           },
+           [](const auto& a)
+           {
+             raise("evaluate_stream: unsupported labelset: ",
+                   *a->labelset());
+           })
+          (aut->as<Aut>());
+      }
+    }
+  }
 } // namespace vcsn
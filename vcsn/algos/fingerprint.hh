@@ -0,0 +1,192 @@
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <vcsn/core/automaton.hh> // all_out, states_size
+#include <vcsn/ctx/traits.hh>
+#include <vcsn/dyn/automaton.hh>
+#include <vcsn/misc/functional.hh> // hash_combine
+
+namespace vcsn
+{
+  namespace detail
+  {
+    /*--------------.
+    | wl_coloring.  |
+    `--------------*/
+
+    /// Weisfeiler-Lehman color refinement of the states of an
+    /// automaton.
+    ///
+    /// Initially pre() and post() have their own colors, and all the
+    /// other states share a third one.  Each round recolors every
+    /// state with a hash of its color and of the sorted multisets of
+    /// (label, weight, color) of its outgoing and incoming
+    /// transitions.  The colors do not depend on the numbering of
+    /// the states and transitions: isomorphic automata have the same
+    /// multisets of colors after each round.  The converse is false.
+    ///
+    /// A round costs O(m log d), where d is the largest degree.
+    template <Automaton Aut>
+    class wl_coloring
+    {
+    public:
+      using automaton_t = Aut;
+      using state_t = state_t_of<automaton_t>;
+      using color_t = std::size_t;
+      using colors_t = std::vector<color_t>;
+
+      /// The largest number of rounds run by run().
+      static constexpr unsigned max_rounds = 16;
+
+      wl_coloring(const automaton_t& aut)
+        : aut_{aut}
+        , colors_(states_size(aut_), 0)
+        , tags_(transitions_size(aut_), 0)
+      {
+        const auto& ls = *aut_->labelset();
+        const auto& ws = *aut_->weightset();
+        for (auto t: all_transitions(aut_))
+          {
+            auto h = ls.hash(aut_->label_of(t));
+            hash_combine(h, ws.hash(aut_->weight_of(t)));
+            tags_[t] = h;
+          }
+        colors_[aut_->pre()] = 1;
+        colors_[aut_->post()] = 2;
+        num_colors_ = count_();
+      }
+
+      /// The color of each state, indexed by state number.
+      const colors_t& colors() const
+      {
+        return colors_;
+      }
+
+      /// The colors of all the states, sorted.
+      colors_t histogram() const
+      {
+        auto res = colors_t{};
+        res.reserve(aut_->num_all_states());
+        for (auto s: aut_->all_states())
+          res.emplace_back(colors_[s]);
+        std::sort(res.begin(), res.end());
+        return res;
+      }
+
+      /// One round of refinement.
+      ///
+      /// \returns whether some classes of states were split.
+      bool refine()
+      {
+        auto next = colors_;
+        auto sigs = colors_t{};
+        for (auto s: aut_->all_states())
+          {
+            auto& res = next[s];
+            hash_neighbors_(res, sigs, all_out(aut_, s),
+                            [this](auto t) { return aut_->dst_of(t); });
+            hash_neighbors_(res, sigs, all_in(aut_, s),
+                            [this](auto t) { return aut_->src_of(t); });
+          }
+        colors_ = std::move(next);
+        ++rounds_;
+        auto num = count_();
+        auto res = num_colors_ < num;
+        num_colors_ = num;
+        return res;
+      }
+
+      /// Refine until the classes are stable, or max_rounds rounds.
+      void run()
+      {
+        while (rounds_ < max_rounds && refine())
+          continue;
+      }
+
+      /// The number of rounds so far.
+      unsigned rounds() const
+      {
+        return rounds_;
+      }
+
+    private:
+      /// Combine into \a res the signatures of the transitions \a ts,
+      /// connecting to the states given by \a neighbor.
+      template <typename Transitions, typename Neighbor>
+      void hash_neighbors_(color_t& res, colors_t& sigs,
+                           const Transitions& ts, Neighbor neighbor) const
+      {
+        sigs.clear();
+        for (auto t: ts)
+          {
+            auto h = tags_[t];
+            hash_combine(h, colors_[neighbor(t)]);
+            sigs.emplace_back(h);
+          }
+        std::sort(sigs.begin(), sigs.end());
+        hash_combine(res, sigs.size());
+        for (auto h: sigs)
+          hash_combine(res, h);
+      }
+
+      /// The number of distinct colors.
+      size_t count_() const
+      {
+        auto h = histogram();
+        return std::unique(h.begin(), h.end()) - h.begin();
+      }
+
+      automaton_t aut_;
+      /// State -> color.
+      colors_t colors_;
+      /// Transition -> hash of its label and weight.
+      colors_t tags_;
+      size_t num_colors_ = 0;
+      unsigned rounds_ = 0;
+    };
+  }
+
+  /*--------------.
+  | fingerprint.  |
+  `--------------*/
+
+  /// A hash of \a aut, invariant under the renumbering of its states
+  /// and transitions.
+  ///
+  /// Isomorphic automata have the same fingerprint, so different
+  /// fingerprints prove that automata are not isomorphic.  Based on
+  /// the Weisfeiler-Lehman color refinement of the states, on labels
+  /// and weights.  The result depends on the hash functions of the
+  /// labels and weights: it is not meant to be stored.
+  template <Automaton Aut>
+  std::size_t
+  fingerprint(const Aut& aut)
+  {
+    auto coloring = detail::wl_coloring<Aut>{aut};
+    coloring.run();
+    auto res = hash_value(std::string{context_t_of<Aut>::sname()});
+    hash_combine(res, aut->num_states());
+    hash_combine(res, aut->num_transitions());
+    for (auto c: coloring.histogram())
+      hash_combine(res, c);
+    return res;
+  }
+
+  namespace dyn
+  {
+    namespace detail
+    {
+      /// Bridge.
+      template <Automaton Aut>
+      std::size_t
+      fingerprint(const automaton& aut)
+      {
+        const auto& a = aut->as<Aut>();
+        return ::vcsn::fingerprint(a);
+      }
+    }
+  }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vcsn/core/frozen-automaton.hh>
+#include <vcsn/dyn/automaton.hh>
+
+namespace vcsn
+{
+  /*---------.
+  | freeze.  |
+  `---------*/
+
+  /// A read-only, compact, copy of \a aut.
+  ///
+  /// The result features the same states (renumbered densely) and
+  /// transitions, stored contiguously and sorted by label.  It is
+  /// well suited for read-only algorithms (evaluate, shortest,
+  /// conjunction operands, etc.); algorithms that build a new
+  /// automaton from it produce mutable automata.
+  template <Automaton Aut>
+  auto
+  freeze(const Aut& aut)
+    -> frozen_automaton<context_t_of<Aut>>
+  {
+    return make_frozen_automaton(aut);
+  }
+
+  namespace dyn
+  {
+    namespace detail
+    {
+      /// Bridge.
+      template <Automaton Aut>
+      automaton
+      freeze(const automaton& aut)
+      {
+        const auto& a = aut->as<Aut>();
+        return ::vcsn::freeze(a);
+      }
+    }
+  }
+}
@@ -4,6 +4,7 @@
 #include <vcsn/algos/shortest.hh>
 #include <vcsn/algos/conjunction.hh> // conjunction
 #include <vcsn/algos/scc.hh>
+#include <vcsn/core/property-cache.hh>
 #include <vcsn/dyn/fwd.hh>
 #include <vcsn/dyn/value.hh>
 
@@ -87,8 +88,13 @@ namespace vcsn
   template <Automaton Aut>
   bool is_ambiguous(const Aut& aut)
   {
-    auto is_ambiguous = detail::is_ambiguous_impl<Aut>{aut};
-    return is_ambiguous();
+    return cached_property
+      (aut, property::ambiguous,
+       [&aut]
+       {
+         auto is_ambiguous = detail::is_ambiguous_impl<Aut>{aut};
+         return is_ambiguous();
+       });
   }
 
   namespace dyn
@@ -167,18 +173,17 @@ namespace vcsn
   bool is_cycle_ambiguous_scc(const Aut& aut)
   {
     auto conj = conjunction(aut, aut);
-    const auto& coms = strong_components(conj,
-                                         scc_algo_t::tarjan_iterative);
+    const auto coms = strong_components_table(conj);
     const auto& origins = conj->origins();
     // In one SCC of conj = aut & aut, if there exist two states (s0,
     // s0) (on the diagonal) and (s1, s2) with s1 != s2 (off the
     // diagonal) then aut has two cycles with the same label:
     // s0->s1->s0 and s0->s2->s0.
-    for (const auto& c : coms)
+    for (size_t i = 0; i < coms.size(); ++i)
       {
         bool on = false;
         bool off = false;
-        for (auto s : c)
+        for (auto s : coms[i])
           {
             auto p = origins.at(s);
             if (std::get<0>(p) == std::get<1>(p))
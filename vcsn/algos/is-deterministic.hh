@@ -4,6 +4,7 @@
 
 #include <vcsn/algos/transpose.hh>
 #include <vcsn/core/automaton.hh> // all_out
+#include <vcsn/core/property-cache.hh>
 #include <vcsn/ctx/traits.hh>
 #include <vcsn/dyn/automaton.hh>
 
@@ -58,13 +59,18 @@ namespace vcsn
     static_assert(labelset_t_of<Aut>::is_free(),
                   "is_deterministic: requires free labelset");
 
-    if (1 < initial_transitions(aut).size())
-      return false;
+    return cached_property
+      (aut, property::deterministic,
+       [&aut]
+       {
+         if (1 < initial_transitions(aut).size())
+           return false;
 
-    for (auto s: aut->states())
-      if (!is_deterministic(aut, s))
-        return false;
-    return true;
+         for (auto s: aut->states())
+           if (!is_deterministic(aut, s))
+             return false;
+         return true;
+       });
   }
 
   /// Whether the transposed automaton is deterministic.
@@ -4,6 +4,7 @@
 
 #include <vcsn/core/automaton.hh> // transitions.
 #include <vcsn/core/kind.hh>
+#include <vcsn/core/property-cache.hh>
 #include <vcsn/ctx/traits.hh>
 #include <vcsn/dyn/automaton.hh> // make_automaton
 #include <vcsn/misc/attributes.hh>
@@ -46,7 +47,8 @@ namespace vcsn
   bool
   is_proper(const Aut& aut)
   {
-    return detail::is_proper_(aut);
+    return cached_property(aut, property::proper,
+                           [&aut] { return detail::is_proper_(aut); });
   }
 
   namespace dyn
@@ -7,6 +7,7 @@
 #include <vcsn/algos/is-proper.hh>
 #include <vcsn/algos/strip.hh>
 #include <vcsn/core/kind.hh>
+#include <vcsn/core/property-cache.hh>
 #include <vcsn/misc/star-status.hh>
 #include <vcsn/misc/direction.hh>
 
@@ -138,7 +139,9 @@ namespace vcsn
   template <Automaton Aut>
   bool is_valid(const Aut& aut)
   {
-    return detail::is_valid_impl<Aut>::is_valid(aut);
+    return cached_property
+      (aut, property::valid,
+       [&aut] { return detail::is_valid_impl<Aut>::is_valid(aut); });
   }
 
   namespace dyn
@@ -5,6 +5,7 @@
 #include <vcsn/algos/k-lightest-path.hh>
 #include <vcsn/algos/a-star.hh>
 #include <vcsn/algos/bellman-ford.hh>
+#include <vcsn/algos/dial.hh>
 #include <vcsn/algos/dijkstra.hh>
 #include <vcsn/algos/tags.hh>
 #include <vcsn/labelset/labelset.hh>
@@ -28,6 +29,8 @@ namespace vcsn
   {
     if (weightset_t_of<Aut>::has_lightening_weights())
       return lightest_path(aut, source, dest, bellman_ford_tag{});
+    else if (detail::is_unsigned_tropical<weightset_t_of<Aut>>::value)
+      return lightest_path(aut, source, dest, radix_heap_tag{});
     else
       return lightest_path(aut, source, dest, dijkstra_tag{});
   }
@@ -60,7 +63,9 @@ namespace vcsn
         {"auto",         detail::lightest_path_tag<Aut, auto_tag>},
         {"a-star",       detail::lightest_path_tag<Aut, a_star_tag>},
         {"bellman-ford", detail::lightest_path_tag<Aut, bellman_ford_tag>},
+        {"dial",         detail::lightest_path_tag<Aut, dial_tag>},
         {"dijkstra",     detail::lightest_path_tag<Aut, dijkstra_tag>},
+        {"radix-heap",   detail::lightest_path_tag<Aut, radix_heap_tag>},
         {"yen",          detail::lightest_path_tag<Aut, yen_tag>},
       }
     };
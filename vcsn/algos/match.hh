@@ -0,0 +1,541 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include <vcsn/algos/constant-term.hh>
+#include <vcsn/algos/to-expansion.hh>
+#include <vcsn/core/rat/expansionset.hh>
+#include <vcsn/core/rat/transpose.hh>
+#include <vcsn/ctx/traits.hh>
+#include <vcsn/dyn/value.hh>
+#include <vcsn/misc/functional.hh> // vcsn::hash
+#include <vcsn/misc/raise.hh>
+#include <vcsn/misc/static-if.hh>
+#include <vcsn/weightset/polynomialset.hh>
+
+namespace vcsn
+{
+  /// Counters of a lazy_matcher.
+  struct lazy_matcher_stats
+  {
+    /// Transitions found in the cache.
+    size_t hits = 0;
+    /// Transitions not found in the cache, hence computed.
+    size_t misses = 0;
+    /// States built.
+    size_t states = 0;
+    /// Flushes of the cache, when it was full.
+    size_t resets = 0;
+    /// Letters read without the cache, as it was thrashing.
+    size_t uncached = 0;
+
+    lazy_matcher_stats& operator+=(const lazy_matcher_stats& s)
+    {
+      hits += s.hits;
+      misses += s.misses;
+      states += s.states;
+      resets += s.resets;
+      uncached += s.uncached;
+      return *this;
+    }
+  };
+
+  inline
+  std::ostream& operator<<(std::ostream& o, const lazy_matcher_stats& s)
+  {
+    return o << "hits: " << s.hits
+             << ", misses: " << s.misses
+             << ", states: " << s.states
+             << ", resets: " << s.resets
+             << ", uncached: " << s.uncached;
+  }
+
+  namespace detail
+  {
+    /*-----------.
+    | lazy_dfa.  |
+    `-----------*/
+
+    /// A deterministic automaton built on the fly from the expansions
+    /// of an expression, with a bounded cache of states.
+    ///
+    /// The states are polynomials of expressions (the derived terms
+    /// reached so far, with their weights), and their transitions are
+    /// computed from the expansions of these expressions when first
+    /// needed.  When the cache is full, it is flushed.  If it is
+    /// flushed twice within less than `min_progress` letters per
+    /// cached state, it is thrashing: the rest of the word is read
+    /// without caching the states, by propagating the polynomials (as
+    /// the expansions are still memoized, this is a simulation of the
+    /// derived-term automaton).
+    ///
+    /// In unanchored mode, the expression is added to the states after
+    /// each letter, so that its matches may start anywhere, and the
+    /// weights are dropped: the states are the supports of the
+    /// polynomials, and the constant terms only tell whether some
+    /// factor may match.
+    template <typename ExpSet>
+    class lazy_dfa
+    {
+    public:
+      using expressionset_t = ExpSet;
+      using expression_t = typename expressionset_t::value_t;
+      using labelset_t = labelset_t_of<expressionset_t>;
+      using label_t = label_t_of<expressionset_t>;
+      using weightset_t = weightset_t_of<expressionset_t>;
+      using weight_t = weight_t_of<expressionset_t>;
+      using polynomialset_t
+        = rat::expression_polynomialset_t<expressionset_t>;
+      using polynomial_t = typename polynomialset_t::value_t;
+      using expansion_t = typename rat::expansionset<expressionset_t>::value_t;
+
+      /// A state number.
+      using state_t = unsigned;
+      /// The state when reading without the cache.
+      static constexpr state_t uncached = -1;
+      /// The number of letters to read per cached state between two
+      /// flushes, below which the cache is deemed to thrash.
+      static constexpr size_t min_progress = 10;
+
+      lazy_dfa(const expressionset_t& rs, const expression_t& e,
+               size_t capacity, bool unanchored = false)
+        : rs_{rs}
+        , exp_{e}
+        , capacity_{std::max(capacity, size_t{2})}
+        , unanchored_{unanchored}
+      {
+        ps_.add_here(init_, exp_, ws_.one());
+      }
+
+      /// Prepare to read a word: the initial state.
+      state_t start()
+      {
+        thrashing_ = false;
+        reset_at_ = boost::none;
+        steps_ = 0;
+        return state_(init_);
+      }
+
+      /// The successor of \a s by \a l.
+      state_t step(state_t s, const label_t& l)
+      {
+        ++steps_;
+        if (s == uncached)
+          {
+            ++stats_.uncached;
+            scratch_ = successor_(scratch_, l);
+            scratch_constant_ = constant_(scratch_);
+            return uncached;
+          }
+        else
+          {
+            auto i = states_[s].succ.find(l);
+            if (i != end(states_[s].succ))
+              {
+                ++stats_.hits;
+                return i->second;
+              }
+            ++stats_.misses;
+            auto resets = stats_.resets;
+            auto res = state_(successor_(*states_[s].poly, l));
+            // If the cache was flushed, s no longer exists.
+            if (res != uncached && resets == stats_.resets)
+              states_[s].succ.emplace(l, res);
+            return res;
+          }
+      }
+
+      /// The weight of the empty word from \a s.
+      const weight_t& constant(state_t s) const
+      {
+        return s == uncached ? scratch_constant_ : states_[s].constant;
+      }
+
+      /// Whether no word is accepted from \a s.
+      bool is_dead(state_t s) const
+      {
+        return ps_.is_zero(s == uncached ? scratch_ : *states_[s].poly);
+      }
+
+      const lazy_matcher_stats& stats() const
+      {
+        return stats_;
+      }
+
+    private:
+      struct state_data
+      {
+        /// The polynomial: the key in index_.
+        const polynomial_t* poly;
+        /// Its constant term.
+        weight_t constant;
+        /// The successors computed so far.
+        std::unordered_map<label_t, state_t,
+                           vcsn::hash<labelset_t>,
+                           vcsn::equal_to<labelset_t>> succ = {};
+      };
+
+      /// The state for polynomial \a p, built if needed.
+      state_t state_(polynomial_t p)
+      {
+        if (!thrashing_)
+          {
+            auto i = index_.find(p);
+            if (i != end(index_))
+              return i->second;
+            if (states_.size() == capacity_)
+              flush_();
+          }
+        if (thrashing_)
+          {
+            scratch_constant_ = constant_(p);
+            scratch_ = std::move(p);
+            return uncached;
+          }
+        else
+          {
+            auto res = state_t(states_.size());
+            auto c = constant_(p);
+            auto i = index_.emplace(std::move(p), res).first;
+            states_.emplace_back(state_data{&i->first, c});
+            ++stats_.states;
+            return res;
+          }
+      }
+
+      /// Flush the cache, and check whether it is thrashing.
+      void flush_()
+      {
+        ++stats_.resets;
+        if (reset_at_ && steps_ - *reset_at_ < min_progress * capacity_)
+          thrashing_ = true;
+        reset_at_ = steps_;
+        states_.clear();
+        index_.clear();
+      }
+
+      /// The expansion of \a e, memoized.
+      const expansion_t& expansion_(const expression_t& e)
+      {
+        auto i = expansions_.find(e);
+        if (i == end(expansions_))
+          {
+            if (expansions_.size() == capacity_)
+              expansions_.clear();
+            i = expansions_.emplace(e, to_expansion_(e)).first;
+          }
+        return i->second;
+      }
+
+      /// The constant term of \a p.
+      weight_t constant_(const polynomial_t& p)
+      {
+        auto res = ws_.zero();
+        for (const auto& m: p)
+          {
+            const auto& c = expansion_(label_of(m)).constant;
+            if (!unanchored_)
+              res = ws_.add(res, ws_.mul(weight_of(m), c));
+            else if (!ws_.is_zero(c))
+              return ws_.one();
+          }
+        return res;
+      }
+
+      /// The successor of \a p by \a l, as a polynomial.
+      ///
+      /// In unanchored mode, the union of the supports of the
+      /// successors of its expressions: the weights cannot cancel.
+      polynomial_t successor_(const polynomial_t& p, const label_t& l)
+      {
+        auto res = ps_.zero();
+        for (const auto& m: p)
+          {
+            const auto& polys = expansion_(label_of(m)).polynomials;
+            auto i = polys.find(l);
+            if (i != end(polys))
+              for (const auto& n: i->second)
+                if (unanchored_)
+                  ps_.set_weight(res, label_of(n), ws_.one());
+                else
+                  ps_.add_here(res, label_of(n),
+                               ws_.mul(weight_of(m), weight_of(n)));
+          }
+        if (unanchored_)
+          ps_.set_weight(res, exp_, ws_.one());
+        return res;
+      }
+
+      expressionset_t rs_;
+      weightset_t ws_ = *rs_.weightset();
+      polynomialset_t ps_ = make_expression_polynomialset(rs_);
+      rat::to_expansion_visitor<expressionset_t> to_expansion_ = {rs_};
+      /// The expression.
+      expression_t exp_;
+      /// The initial polynomial: exp_.
+      polynomial_t init_ = ps_.zero();
+      /// The largest number of states, and of expansions, in the cache.
+      size_t capacity_;
+      bool unanchored_;
+
+      /// The cached states.
+      std::vector<state_data> states_;
+      /// Polynomial -> state.
+      std::unordered_map<polynomial_t, state_t,
+                         vcsn::hash<polynomialset_t>,
+                         vcsn::equal_to<polynomialset_t>> index_;
+      /// Expression -> expansion.
+      std::unordered_map<expression_t, expansion_t,
+                         vcsn::hash<expressionset_t>,
+                         vcsn::equal_to<expressionset_t>> expansions_;
+      /// The current polynomial, and its constant term, when uncached.
+      polynomial_t scratch_ = ps_.zero();
+      weight_t scratch_constant_ = ws_.zero();
+
+      /// The number of letters read in the current word.
+      size_t steps_ = 0;
+      /// The value of steps_ at the last flush in the current word.
+      boost::optional<size_t> reset_at_;
+      /// Whether we gave up on the cache for the current word.
+      bool thrashing_ = false;
+      lazy_matcher_stats stats_;
+    };
+  }
+
+  /*---------------.
+  | lazy_matcher.  |
+  `---------------*/
+
+  /// Match words against an expression, without building its
+  /// automaton.
+  ///
+  /// Based on deterministic automata built on the fly from the
+  /// expansions of the expression, with a bounded number of states
+  /// (see detail::lazy_dfa).  They are kept from one word to the
+  /// other: reuse the matcher to match many words.  Not thread-safe.
+  template <typename ExpSet>
+  class lazy_matcher
+  {
+  public:
+    using expressionset_t = ExpSet;
+    using expression_t = typename expressionset_t::value_t;
+    using labelset_t = labelset_t_of<expressionset_t>;
+    using label_t = label_t_of<expressionset_t>;
+    using word_t = word_t_of<expressionset_t>;
+    using weightset_t = weightset_t_of<expressionset_t>;
+    using weight_t = weight_t_of<expressionset_t>;
+    using dfa_t = detail::lazy_dfa<expressionset_t>;
+    /// A factor: the positions of its first letter, and past its last.
+    using factor_t = std::pair<size_t, size_t>;
+
+    static_assert(labelset_t::is_free(),
+                  "lazy_matcher: requires a free labelset");
+
+    /// The default largest number of states of each automaton.
+    static constexpr size_t default_capacity = 10000;
+
+    lazy_matcher(const expressionset_t& rs, const expression_t& e,
+                 size_t capacity = default_capacity)
+      : rs_{rs}
+      , exp_{e}
+      , capacity_{capacity}
+      , dfa_{rs_, exp_, capacity_}
+    {}
+
+    /// The weight of \a w.
+    weight_t match(const word_t& w)
+    {
+      auto s = dfa_.start();
+      for (const auto l: ls_.letters_of(w))
+        {
+          s = dfa_.step(s, l);
+          if (dfa_.is_dead(s))
+            return ws_.zero();
+        }
+      return dfa_.constant(s);
+    }
+
+    /// The first factor of \a w whose weight is not zero.
+    ///
+    /// Among the factors that end first, the longest one.  Read \a w
+    /// once forward, looking for the end of a match in unanchored
+    /// mode, then backward from there, with the transposed
+    /// expression, to find its beginning.
+    boost::optional<factor_t> search(const word_t& w)
+    {
+      auto letters = std::vector<label_t>{};
+      for (const auto l: ls_.letters_of(w))
+        letters.emplace_back(l);
+
+      if (!forward_)
+        forward_.emplace(rs_, exp_, capacity_, true);
+      auto s = forward_->start();
+      for (size_t end = 0;; ++end)
+        {
+          // In unanchored mode, matches are only possible: check.
+          if (!ws_.is_zero(forward_->constant(s)))
+            if (auto b = begin_(letters, end))
+              return factor_t{*b, end};
+          if (end == letters.size())
+            return boost::none;
+          s = forward_->step(s, letters[end]);
+        }
+    }
+
+    /// The counters of all the automata.
+    lazy_matcher_stats stats() const
+    {
+      auto res = dfa_.stats();
+      if (forward_)
+        res += forward_->stats();
+      if (backward_)
+        res += backward_->stats();
+      return res;
+    }
+
+  private:
+    /// The first position of the longest factor of \a letters ending
+    /// at \a end whose weight is not zero.
+    boost::optional<size_t>
+    begin_(const std::vector<label_t>& letters, size_t end)
+    {
+      if (!backward_)
+        backward_.emplace(rs_, transpose(rs_, exp_), capacity_);
+      auto res = boost::optional<size_t>{};
+      auto s = backward_->start();
+      for (auto i = end;; --i)
+        {
+          if (!ws_.is_zero(backward_->constant(s)))
+            res = i;
+          if (i == 0)
+            break;
+          s = backward_->step(s, letters[i - 1]);
+          if (backward_->is_dead(s))
+            break;
+        }
+      return res;
+    }
+
+    expressionset_t rs_;
+    labelset_t ls_ = *rs_.labelset();
+    weightset_t ws_ = *rs_.weightset();
+    expression_t exp_;
+    size_t capacity_;
+    /// The anchored automaton, for match.
+    dfa_t dfa_;
+    /// The unanchored automaton, and the automaton of the transposed
+    /// expression, for search.
+    boost::optional<dfa_t> forward_;
+    boost::optional<dfa_t> backward_;
+  };
+
+  /// Build a lazy_matcher.
+  template <typename ExpSet>
+  lazy_matcher<ExpSet>
+  make_lazy_matcher(const ExpSet& rs, const typename ExpSet::value_t& e,
+                    size_t capacity = lazy_matcher<ExpSet>::default_capacity)
+  {
+    return {rs, e, capacity};
+  }
+
+  /*--------.
+  | match.  |
+  `--------*/
+
+  /// The weight of \a w in \a e, without building an automaton.
+  ///
+  /// To match several words, reuse a lazy_matcher.
+  template <typename ExpSet>
+  weight_t_of<ExpSet>
+  match(const ExpSet& rs, const typename ExpSet::value_t& e,
+        const word_t_of<ExpSet>& w)
+  {
+    auto m = make_lazy_matcher(rs, e);
+    return m.match(w);
+  }
+
+  /*---------.
+  | search.  |
+  `---------*/
+
+  /// The first factor of \a w whose weight in \a e is not zero.
+  template <typename ExpSet>
+  boost::optional<std::pair<size_t, size_t>>
+  search(const ExpSet& rs, const typename ExpSet::value_t& e,
+         const word_t_of<ExpSet>& w)
+  {
+    auto m = make_lazy_matcher(rs, e);
+    return m.search(w);
+  }
+
+  namespace dyn
+  {
+    namespace detail
+    {
+      /// Report the counters of \a m if VCSN_DEBUG is set.
+      template <typename Matcher>
+      void debug_matcher(const char* algo, const Matcher& m)
+      {
+        static bool debug = getenv("VCSN_DEBUG");
+        if (debug)
+          std::cerr << algo << ": " << m.stats() << '\n';
+      }
+
+      /// Bridge.
+      template <typename ExpSet, typename LabelSet>
+      weight
+      match(const expression& exp, const label& lbl)
+      {
+        const auto& e = exp->as<ExpSet>();
+        const auto& w = lbl->as<LabelSet>().value();
+        return vcsn::detail::static_if<labelset_t_of<ExpSet>::is_free()>
+          ([](const auto& rs, const auto& r, const auto& w) -> weight
+           {
+             auto m = make_lazy_matcher(rs, r);
+             auto res = m.match(w);
+             debug_matcher("match", m);
+             return {*rs.weightset(), res};
+           },
+           [](const auto& rs, const auto&, const auto&) -> weight
+           {
+             raise("match: unsupported labelset: ", *rs.labelset());
+           })
+          (e.valueset(), e.value(), w);
+      }
+
+      /// Bridge.
+      template <typename ExpSet, typename LabelSet>
+      std::vector<unsigned>
+      search(const expression& exp, const label& lbl)
+      {
+        const auto& e = exp->as<ExpSet>();
+        const auto& w = lbl->as<LabelSet>().value();
+        return vcsn::detail::static_if<labelset_t_of<ExpSet>::is_free()>
+          ([](const auto& rs, const auto& r, const auto& w)
+             -> std::vector<unsigned>
+           {
+             auto m = make_lazy_matcher(rs, r);
+             auto f = m.search(w);
+             debug_matcher("search", m);
+             if (f)
+               return {unsigned(f->first), unsigned(f->second)};
+             else
+               return {};
+           },
+           [](const auto& rs, const auto&, const auto&)
+             -> std::vector<unsigned>
+           {
+             raise("search: unsupported labelset: ", *rs.labelset());
+           })
+          (e.valueset(), e.value(), w);
+      }
+    }
+  }
+}
@@ -1,17 +1,17 @@
 #pragma once
 
-#include <algorithm>
+#include <map>
+#include <vector>
 
+#include <vcsn/algos/is-deterministic.hh>
 #include <vcsn/algos/is-free-boolean.hh>
 #include <vcsn/algos/quotient.hh>
-#include <vcsn/labelset/stateset.hh>
+#include <vcsn/core/automaton.hh> // states_size
 #include <vcsn/misc/attributes.hh>
-#include <vcsn/misc/dynamic_bitset.hh>
-#include <vcsn/misc/set.hh>
-#include <vcsn/misc/vector.hh>
-#include <vcsn/misc/wet.hh>
+#include <vcsn/misc/map.hh> // vcsn::less
+#include <vcsn/misc/raise.hh>
+#include <vcsn/misc/refinable-partition.hh>
 #include <vcsn/weightset/b.hh>
-#include <vcsn/weightset/polynomialset.hh>
 
 namespace vcsn
 {
@@ -23,78 +23,113 @@ namespace vcsn
   /// Request for Hopcroft implementation of minimize (B and free).
   struct hopcroft_tag {};
 
+  /// Hopcroft's algorithm, on a refinable partition.
+  ///
+  /// The automaton, including its pre and post states, is seen as a
+  /// partial deterministic automaton on the generators and the
+  /// special label.  Each time a block is split, only the smaller
+  /// half needs to be used as a splitter, unless the block was
+  /// already waiting to be one.  So each state is used at most
+  /// log(n) times, and the complexity is O(m log n), where m is the
+  /// number of transitions.
   template <Automaton Aut>
   std::enable_if_t<is_free_boolean<Aut>(), quotient_t<Aut>>
   minimize(const Aut& a, hopcroft_tag)
   {
+    require(is_deterministic(a),
+            "minimize-hopcroft: input must be deterministic");
     using state_t = state_t_of<Aut>;
-    using stateset_t = stateset<Aut>;
-    auto ctx = make_context(stateset_t(a), *a->weightset());
-    auto ps = detail::make_polynomialset<decltype(ctx),
-                                         wet_kind_t::bitset>(ctx);
-    using set_t = typename decltype(ps)::value_t;
-    using partition_t = std::set<set_t>;
+    using elt_t = refinable_partition::elt_t;
+    using block_t = refinable_partition::block_t;
 
-    auto size = states_size(a);
-
-    auto f = set_t(size);
-    f.set(a->post());
-
-    auto q = set_t(size);
+    // Number the states densely, post first.
+    auto states = std::vector<state_t>{a->post()};
+    auto index = std::vector<elt_t>(states_size(a));
     for (auto s: a->all_states())
-      q.set(s);
-    q.erase(a->post());
-
-    auto p = partition_t{f, q};
-    auto w = partition_t{f};
+      if (s != a->post())
+        {
+          index[s] = states.size();
+          states.emplace_back(s);
+        }
+    const auto n = states.size();
 
+    // Number the labels.
     const auto& ls = *a->labelset();
-    auto generators = detail::make_vector(ls.generators());
-    generators.emplace_back(ls.special());
+    auto labels = std::map<label_t_of<Aut>, unsigned,
+                           vcsn::less<labelset_t_of<Aut>>>{};
+    for (auto l: ls.generators())
+      labels.emplace(l, labels.size());
+    labels.emplace(ls.special(), labels.size());
 
-    while (!w.empty())
+    // The incoming transitions of each state: (label, source), in a
+    // compressed row layout: those of states[i] are in
+    // [in_offsets[i], in_offsets[i+1]).
+    auto in_offsets = std::vector<size_t>(n + 1, 0);
+    for (auto t: all_transitions(a))
+      ++in_offsets[index[a->dst_of(t)] + 1];
+    for (size_t i = 0; i < n; ++i)
+      in_offsets[i + 1] += in_offsets[i];
+    auto ins = std::vector<std::pair<unsigned, elt_t>>(in_offsets[n]);
+    {
+      auto pos = std::vector<size_t>(begin(in_offsets), end(in_offsets) - 1);
+      for (auto t: all_transitions(a))
+        ins[pos[index[a->dst_of(t)]]++]
+          = {labels.at(a->label_of(t)), index[a->src_of(t)]};
+    }
+
+    // Initial partition: post, and the other states.  Both are
+    // splitters: the automaton is partial, so the partition is not
+    // stable with respect to the set of all the states.
+    auto p = refinable_partition(n);
+    auto w = std::vector<block_t>{};
+    auto in_w = std::vector<bool>{};
+    auto add_splitter = [&](block_t b)
       {
-        auto sub_w = std::move(*begin(w));
-        w.erase(begin(w));
-        for (const auto l: generators)
+        if (in_w.size() <= b)
+          in_w.resize(b + 1, false);
+        if (!in_w[b])
           {
-            auto x = set_t(size);
-            for (auto s: sub_w)
-              for (auto t: in(a, label_of(s), l))
-                x.set(a->src_of(t));
-            auto p2 = partition_t(p);
-            for (auto y: p2)
-              {
-                auto xny = x & y;
-                auto x_y = y - x;
-                if (!xny.empty() && !x_y.empty())
-                  {
-                    auto it = w.find(y);
-                    if (it != end(w))
-                      {
-                        w.erase(it);
-                        w.insert(xny);
-                        w.insert(x_y);
-                      }
-                    else
-                      w.insert(xny.size() <= x_y.size() ? xny : x_y);
-                    p.erase(y);
-                    p.insert(std::move(xny));
-                    p.insert(std::move(x_y));
-                  }
-              }
+            in_w[b] = true;
+            w.emplace_back(b);
           }
+      };
+    p.mark(0);
+    p.split([](block_t, block_t) {});
+    add_splitter(0);
+    if (2 <= p.num_blocks())
+      add_splitter(1);
+
+    // The sources of the transitions into the current splitter,
+    // by label.
+    auto srcs = std::vector<std::vector<elt_t>>(labels.size());
+    while (!w.empty())
+      {
+        auto c = w.back();
+        w.pop_back();
+        in_w[c] = false;
+        auto range = p.block(c);
+        for (auto e = range.first; e != range.second; ++e)
+          for (auto i = in_offsets[*e]; i < in_offsets[*e + 1]; ++i)
+            srcs[ins[i].first].emplace_back(ins[i].second);
+        for (auto& ss: srcs)
+          if (!ss.empty())
+            {
+              for (auto s: ss)
+                p.mark(s);
+              ss.clear();
+              p.split([&](block_t b, block_t nb)
+                      {
+                        if (b < in_w.size() && in_w[b])
+                          add_splitter(nb);
+                        else
+                          add_splitter(p.size(nb) <= p.size(b) ? nb : b);
+                      });
+            }
       }
-    auto res = std::vector<std::vector<state_t>>{};
-    std::transform(begin(p), end(p), std::back_inserter(res),
-        [](const set_t& set)
-        {
-          auto res = std::vector<state_t>();
-          res.reserve(set.size());
-          for (auto s: set)
-            res.push_back(label_of(s));
-          return res;
-        });
+
+    auto res = std::vector<std::vector<state_t>>(p.num_blocks());
+    for (elt_t i = 0; i < n; ++i)
+      res[p.block_of(i)].emplace_back(states[i]);
     return quotient(a, res);
   }
 
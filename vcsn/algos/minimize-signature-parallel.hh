@@ -0,0 +1,291 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+#include <vcsn/algos/accessible.hh> // is_trim
+#include <vcsn/algos/quotient.hh>
+#include <vcsn/core/automaton.hh> // states_size
+#include <vcsn/misc/attributes.hh>
+#include <vcsn/misc/debug-level.hh>
+#include <vcsn/misc/functional.hh> // hash_combine
+#include <vcsn/misc/map.hh> // vcsn::less
+#include <vcsn/misc/parallel.hh>
+#include <vcsn/misc/raise.hh>
+#include <vcsn/weightset/fwd.hh> // b
+
+namespace vcsn
+{
+
+  /*-------------------------------------------------------------.
+  | minimization with Moore's algorithm: parallel signatures.    |
+  `-------------------------------------------------------------*/
+
+  /// Request for the parallel signature implementation of minimize (B).
+  struct signature_parallel_tag {};
+
+  /// Statistics about a refinement round of the parallel minimization.
+  struct minimize_round
+  {
+    /// The number of the round, starting at 1.
+    unsigned round;
+    /// The number of classes after this round.
+    size_t num_classes;
+    /// The time spent in this round, in seconds.
+    double seconds;
+  };
+
+  /// The instrumentation hook: called after each refinement round.
+  using minimize_hook_t = std::function<void(const minimize_round&)>;
+
+  namespace detail
+  {
+    template <Automaton Aut>
+    class minimizer<Aut, signature_parallel_tag>
+    {
+      static_assert(std::is_same<weightset_t_of<Aut>, b>::value,
+                    "minimize: signature,parallel: requires Boolean weights");
+
+      using automaton_t = Aut;
+
+      using labelset_t = labelset_t_of<automaton_t>;
+      using label_t = label_t_of<automaton_t>;
+      using state_t = state_t_of<automaton_t>;
+      using class_t = unsigned;
+      using set_t = std::vector<state_t>;
+      using class_to_set_t = std::vector<set_t>;
+
+      /// A signature: the sorted pairs (label number, destination
+      /// class), followed by the class of the state.
+      using signature_t = std::vector<std::pair<unsigned, class_t>>;
+
+      constexpr static const char* me()
+      {
+        return "minimize-signature-parallel";
+      }
+
+    public:
+      /// \param a            the automaton to minimize
+      /// \param num_threads  the number of threads (0 for as many as
+      ///                     supported by the hardware)
+      /// \param hook         called after each round of refinement.
+      ///                     If empty and VCSN_DEBUG is set, the rounds
+      ///                     are reported on std::cerr.
+      minimizer(const Aut& a,
+                unsigned num_threads = 0, minimize_hook_t hook = {})
+        : a_(a)
+        , num_threads_(detail::num_threads(num_threads))
+        , hook_(std::move(hook))
+      {
+        require(is_trim(a_), me(), ": input must be trim");
+        if (!hook_ && debug_level())
+          hook_ = [](const minimize_round& r)
+            {
+              std::cerr << "minimize: signature,parallel: round " << r.round
+                        << ": " << r.num_classes << " classes, "
+                        << r.seconds << "s\n";
+            };
+
+        // Number the states densely.
+        index_.resize(states_size(a_));
+        for (auto s: a_->all_states())
+          {
+            index_[s] = states_.size();
+            states_.emplace_back(s);
+          }
+
+        // Number the labels, and store the outgoing transitions as
+        // (label number, destination index), in a compressed sparse
+        // row layout.
+        auto labels = std::map<label_t, unsigned, vcsn::less<labelset_t>>{};
+        offsets_.reserve(states_.size() + 1);
+        offsets_.emplace_back(0);
+        for (auto s: states_)
+          {
+            for (auto t: all_out(a_, s))
+              {
+                auto l = labels.emplace(a_->label_of(t), labels.size()).first;
+                succs_.emplace_back(l->second, index_[a_->dst_of(t)]);
+              }
+            offsets_.emplace_back(succs_.size());
+          }
+      }
+
+      /// The partition, as a list of classes.
+      class_to_set_t& classes()
+      {
+        build_classes_();
+        return class_to_set_;
+      }
+
+    private:
+      /// Split the classes until fix point.
+      ///
+      /// Each round computes the signatures of all the states
+      /// concurrently.  Then the states are bucketed by the shard of
+      /// their hash, and grouped by signature, each thread handling
+      /// its own shards.
+      /// Finally the new classes are numbered sequentially, in the
+      /// order of their first state, so that the result does not
+      /// depend on the number of threads.
+      void build_classes_()
+      {
+        const size_t n = states_.size();
+        // Start with a single class: the signatures distinguish pre,
+        // post, and the final states.
+        auto cls = std::vector<class_t>(n, 0);
+        auto sigs = std::vector<signature_t>(n);
+        auto hashes = std::vector<size_t>(n);
+        auto reps = std::vector<size_t>(n);
+        // The states sorted by shard, and the start of each shard.
+        auto by_shard = std::vector<size_t>(n);
+        auto shards = std::vector<size_t>(num_threads_ + 1);
+        size_t num_classes = 1;
+        for (unsigned round = 1;; ++round)
+          {
+            auto start = std::chrono::steady_clock::now();
+
+            detail::parallel_for(n, num_threads_,
+                                 [&](size_t i)
+              {
+                auto& sig = sigs[i];
+                sig.clear();
+                for (auto j = offsets_[i]; j < offsets_[i + 1]; ++j)
+                  sig.emplace_back(succs_[j].first, cls[succs_[j].second]);
+                std::sort(begin(sig), end(sig));
+                sig.erase(std::unique(begin(sig), end(sig)), end(sig));
+                sig.emplace_back(unsigned(-1), cls[i]);
+                size_t h = 0;
+                for (const auto& p: sig)
+                  {
+                    hash_combine_hash(h, p.first);
+                    hash_combine_hash(h, p.second);
+                  }
+                hashes[i] = h;
+              }, 256);
+
+            // Bucket the states by shard (a counting sort).  It is
+            // stable: in each shard, the states remain in increasing
+            // order.
+            std::fill(begin(shards), end(shards), 0);
+            for (size_t i = 0; i < n; ++i)
+              ++shards[hashes[i] % num_threads_ + 1];
+            std::partial_sum(begin(shards), end(shards), begin(shards));
+            {
+              auto next = shards;
+              for (size_t i = 0; i < n; ++i)
+                by_shard[next[hashes[i] % num_threads_]++] = i;
+            }
+
+            // Map each state to the first state with the same signature.
+            detail::parallel_chunks(num_threads_, num_threads_,
+                                    [&](size_t, size_t b, size_t e)
+              {
+                using map_t = std::unordered_map<size_t, std::vector<size_t>>;
+                auto firsts = map_t{};
+                for (auto j = shards[b]; j < shards[e]; ++j)
+                  {
+                    const auto i = by_shard[j];
+                    auto& cands = firsts[hashes[i]];
+                    auto k = std::find_if(begin(cands), end(cands),
+                                          [&](size_t c)
+                                          {
+                                            return sigs[c] == sigs[i];
+                                          });
+                    if (k == end(cands))
+                      {
+                        cands.emplace_back(i);
+                        reps[i] = i;
+                      }
+                    else
+                      reps[i] = *k;
+                  }
+              });
+
+            // Number the classes in the order of their first state.
+            size_t num = 0;
+            for (size_t i = 0; i < n; ++i)
+              cls[i] = reps[i] == i ? num++ : cls[reps[i]];
+
+            auto stop = std::chrono::steady_clock::now();
+            if (hook_)
+              hook_(minimize_round{round, num,
+                    std::chrono::duration<double>(stop - start).count()});
+
+            // Since the signature of a state includes its class,
+            // classes are only split.  So if their number did not
+            // change, the partition is stable.
+            if (num == num_classes)
+              break;
+            num_classes = num;
+          }
+
+        class_to_set_.clear();
+        class_to_set_.resize(num_classes);
+        for (size_t i = 0; i < n; ++i)
+          class_to_set_[cls[i]].emplace_back(states_[i]);
+      }
+
+      /// Input automaton, supplied at construction time.
+      automaton_t a_;
+      /// The number of threads.
+      unsigned num_threads_;
+      /// The instrumentation hook.
+      minimize_hook_t hook_;
+
+      /// The states of a_, densely numbered.
+      std::vector<state_t> states_;
+      /// The dense number of each state of a_.
+      std::vector<size_t> index_;
+      /// The outgoing transitions of states_[i] are
+      /// succs_[offsets_[i], offsets_[i+1]).
+      std::vector<size_t> offsets_;
+      /// The outgoing transitions: (label number, destination index).
+      std::vector<std::pair<unsigned, size_t>> succs_;
+
+      class_to_set_t class_to_set_;
+    };
+  } // detail::
+
+  /// Boolean minimization, computing the signatures of the states
+  /// with \a num_threads threads (0 for as many as supported by the
+  /// hardware).
+  ///
+  /// \param a            the automaton to minimize
+  /// \param num_threads  the number of threads
+  /// \param hook         called after each refinement round, with
+  ///                     its number, the number of classes and the
+  ///                     time it took.
+  template <Automaton Aut>
+  auto
+  minimize_parallel(const Aut& a, unsigned num_threads = 0,
+                    minimize_hook_t hook = {})
+    -> quotient_t<Aut>
+  {
+    auto minimize = detail::minimizer<Aut, signature_parallel_tag>
+      {a, num_threads, std::move(hook)};
+    return quotient(a, minimize.classes());
+  }
+
+  namespace dyn
+  {
+    namespace detail
+    {
+      template <Automaton Aut>
+      ATTRIBUTE_NORETURN
+      std::enable_if_t<!std::is_same<weightset_t_of<Aut>, b>::value,
+                        quotient_t<Aut>>
+      minimize(const Aut&, signature_parallel_tag)
+      {
+        raise("minimize: invalid algorithm (non-Boolean):"
+              " signature,parallel");
+      }
+    }
+  }
+} // namespace vcsn
@@ -5,6 +5,7 @@
 #include <vcsn/algos/minimize-brzozowski.hh>
 #include <vcsn/algos/minimize-hopcroft.hh>
 #include <vcsn/algos/minimize-moore.hh>
+#include <vcsn/algos/minimize-signature-parallel.hh>
 #include <vcsn/algos/minimize-signature.hh>
 #include <vcsn/algos/minimize-weighted.hh>
 #include <vcsn/algos/tags.hh>
@@ -18,7 +19,7 @@ namespace vcsn
   ///
   /// \tparam Aut  the input automaton type.
   /// \tparam Tag  the requested algorithm:
-  ///      moore_tag, signature_tag, weighted_tag.
+  ///      moore_tag, signature_tag, signature_parallel_tag, weighted_tag.
   template <Automaton Aut, typename Tag>
   auto
   minimize(const Aut& a, Tag)
@@ -64,6 +65,8 @@ namespace vcsn
         {"hopcroft",  [](const Aut& a){ return minimize(a, hopcroft_tag{}); }},
         {"moore",     [](const Aut& a){ return minimize(a, moore_tag{}); }},
         {"signature", [](const Aut& a){ return minimize(a, signature_tag{}); }},
+        {"signature,parallel",
+                      [](const Aut& a){ return minimize_parallel(a); }},
         {"weighted",  [](const Aut& a){ return minimize(a, weighted_tag{}); }},
       }
     };
@@ -89,6 +92,8 @@ namespace vcsn
       {
         {"auto",      [](const Aut& a){ return minimize(a, auto_tag{}); }},
         {"signature", [](const Aut& a){ return minimize(a, signature_tag{}); }},
+        {"signature,parallel",
+                      [](const Aut& a){ return minimize_parallel(a); }},
         {"weighted",  [](const Aut& a){ return minimize(a, weighted_tag{}); }},
       }
     };
@@ -166,6 +171,8 @@ namespace vcsn
               {"hopcroft",   minimize_tag_<Aut, hopcroft_tag>},
               {"moore",      minimize_tag_<Aut, moore_tag>},
               {"signature",  minimize_tag_<Aut, signature_tag>},
+              {"signature,parallel",
+                             minimize_tag_<Aut, signature_parallel_tag>},
               {"weighted",   minimize_tag_<Aut, weighted_tag>},
             }
           };
@@ -204,6 +211,8 @@ namespace vcsn
               {"hopcroft",   cominimize_tag_<Aut, hopcroft_tag>},
               {"moore",      cominimize_tag_<Aut, moore_tag>},
               {"signature",  cominimize_tag_<Aut, signature_tag>},
+              {"signature,parallel",
+                             cominimize_tag_<Aut, signature_parallel_tag>},
               {"weighted",   cominimize_tag_<Aut, weighted_tag>},
             }
           };
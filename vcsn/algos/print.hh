@@ -8,6 +8,7 @@
 #include <vcsn/algos/grail.hh>
 #include <vcsn/algos/info.hh>
 #include <vcsn/algos/tikz.hh>
+#include <vcsn/algos/vbin.hh>
 #include <vcsn/core/rat/dot.hh>
 #include <vcsn/ctx/context.hh>
 #include <vcsn/dyn/context.hh>
@@ -106,6 +107,7 @@ namespace vcsn
           {"info,size",    [](const Aut& a, std::ostream& o){ info(a, o, 1); }},
           {"null",         [](const Aut&, std::ostream&){}},
           {"tikz",         [](const Aut& a, std::ostream& o){ tikz(a, o); }},
+          {"vbin",         [](const Aut& a, std::ostream& o){ vbin(a, o); }},
         }
       };
     map[fmt](aut, out);
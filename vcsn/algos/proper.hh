@@ -13,6 +13,7 @@
 #include <vcsn/algos/is-proper.hh>
 #include <vcsn/algos/is-valid.hh>
 #include <vcsn/core/kind.hh>
+#include <vcsn/core/property-cache.hh>
 #include <vcsn/misc/builtins.hh>
 #include <vcsn/misc/direction.hh>
 #include <vcsn/misc/getargs.hh>
@@ -248,7 +249,12 @@ namespace vcsn
     switch (dir)
       {
       case direction::backward:
-        return detail::make_properer(aut, prune, algo)();
+        {
+          auto res = detail::make_properer(aut, prune, algo)();
+          set_property(res, property::proper);
+          set_property(res, property::valid);
+          return res;
+        }
       case direction::forward:
         return transpose(proper(transpose(aut),
                                 direction::backward, prune, algo));
@@ -1,16 +1,22 @@
 #pragma once
 
+#include <algorithm>
 #include <map>
-#include <unordered_map>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 #include <vcsn/algos/copy.hh>
 #include <vcsn/algos/transpose.hh>
 #include <vcsn/core/automaton.hh>
 #include <vcsn/dyn/automaton.hh>
+#include <vcsn/misc/parallel.hh>
 #include <vcsn/weightset/q.hh>
+#include <vcsn/weightset/qh.hh>
+#include <vcsn/weightset/qmp.hh>
 #include <vcsn/weightset/r.hh>
 #include <vcsn/weightset/z.hh>
+#include <vcsn/weightset/zh.hh>
 
 namespace vcsn
 {
@@ -37,12 +43,24 @@ namespace vcsn
       updated in such a way that the pivot becomes the first  non zero
       entry of v, which is inserted in the basis.
 
+      The successors of the vectors of the basis are processed by
+      batches: they are first all reduced w.r.t. the vectors that are
+      already in the basis, independently of each other (hence in
+      parallel), and then, one at a time and in order, w.r.t. the
+      vectors added to the basis since.  This performs exactly the
+      same operations on each vector as one at a time.  In Z, where
+      the reduction also modifies the basis, the batches are reduced
+      to a single vector.
+
       Once the basis is stabilized, a bottom-up reduction is applied
       to the scaled basis in order to make it more "diagonal".
       Finally, the new automaton is built w.r.t. the computed basis.
       The construction of the automaton can not be done on-the-fly due
       to both the Z case where the basis is modified and the bottom-up
       reduction.
+
+      The matrices are sparse (compressed rows, one per letter), and
+      the vectors are dense.
     */
 
 
@@ -57,6 +75,9 @@ namespace vcsn
 
        reduce_vector computes current := current - current[i].b_i
 
+       reduce_rows applies reduce_vector to independent vectors, in
+       parallel
+
        normalisation_vector applied a ratio in such a way that
        the pivot is 1
 
@@ -68,13 +89,26 @@ namespace vcsn
        In Q : find_pivot searchs for the entry where
        |numerator|+|denominator| is minimal
 
+       In Q, QMP, QH and R : vector_in_new_basis reads the
+       coordinates at the pivots, since after the bottom-up
+       reduction, the basis is in reduced echelon form
+
+       In QMP and QH : reduce_rows and bottom_up_reduction are
+       fraction-free: they work on integral vectors proportional to
+       the rational ones, and go back to rationals once done.  Q
+       keeps its native arithmetics, so that it does not depend on
+       GMP
+
        In R : find_pivot searchs for the entry x where |x|+1/|x|
        is minimal
+       reduce_vector works on the whole (contiguous) vector
+       reduce_rows works by blocks of rows
 
-       In Z : find_pivot searchs for the (non zero) entry x where
+       In Z and ZH : find_pivot searchs for the (non zero) entry x where
        |x| is minimal
        reduce_vector both reduce the current and the basis vector
          (w.r.t. the gcd of current[i] and b_i[i])
+       reduce_rows is sequential, since the basis is modified
        normalisation_vector does not apply
        bottom_up_reduction does not apply
 
@@ -83,6 +117,9 @@ namespace vcsn
     template <typename Weightset>
     struct select
     {
+      /// Whether reduce_vector modifies the basis vector.
+      static constexpr bool modifies_basis = false;
+
       template <typename Reduc, typename Vector>
       static unsigned
       find_pivot(Reduc* that, const Vector& v,
@@ -99,6 +136,14 @@ namespace vcsn
         that->reduce_vector(vbasis, current, b, permutation);
       }
 
+      template <typename Reduc, typename Basis>
+      static void
+      reduce_rows(Reduc* that, Basis& basis, Basis& rows,
+                  unsigned begin, unsigned end, unsigned* permutation)
+      {
+        that->reduce_rows(basis, rows, begin, end, permutation);
+      }
+
       template <typename Reduc, typename Vector>
       static void
       normalisation_vector(Reduc* that, Vector& v,
@@ -124,6 +169,35 @@ namespace vcsn
       }
     };
 
+    /// QMP and QH: fraction-free reductions.
+    struct select_rational : select<void>
+    {
+      template <typename Reduc, typename Basis>
+      static void
+      reduce_rows(Reduc* that, Basis& basis, Basis& rows,
+                  unsigned begin, unsigned end, unsigned* permutation)
+      {
+        that->q_reduce_rows(basis, rows, begin, end, permutation);
+      }
+
+      template <typename Reduc, typename Basis>
+      static void
+      bottom_up_reduction(Reduc* that, Basis& basis, unsigned* permutation)
+      {
+        that->q_bottom_up_reduction(basis, permutation);
+      }
+
+      template <typename Reduc, typename Basis, typename Vector>
+      static void
+      vector_in_new_basis(Reduc* that, Basis& basis,
+                          Vector& current, Vector& new_vector,
+                          unsigned* permutation)
+      {
+        that->read_vector_in_new_basis(basis, current, new_vector,
+                                       permutation);
+      }
+    };
+
     template <>
     struct select<q> : select<void>
     {
@@ -134,8 +208,26 @@ namespace vcsn
       {
         return that->find_pivot_by_norm(v, begin, permutation);
       }
+
+      template <typename Reduc, typename Basis, typename Vector>
+      static void
+      vector_in_new_basis(Reduc* that, Basis& basis,
+                          Vector& current, Vector& new_vector,
+                          unsigned* permutation)
+      {
+        that->read_vector_in_new_basis(basis, current, new_vector,
+                                       permutation);
+      }
     };
 
+    template <>
+    struct select<qmp> : select_rational
+    {};
+
+    template <>
+    struct select<qh> : select_rational
+    {};
+
     template <>
     struct select<r> : select<void>
     {
@@ -146,11 +238,39 @@ namespace vcsn
       {
         return that->find_pivot_by_norm(v, begin, permutation);
       }
+
+      template <typename Reduc, typename Vector>
+      static void
+      reduce_vector(Reduc* that, Vector& vbasis,
+                    Vector& current, unsigned b, unsigned* permutation)
+      {
+        that->r_reduce_vector(vbasis, current, b, permutation);
+      }
+
+      template <typename Reduc, typename Basis>
+      static void
+      reduce_rows(Reduc* that, Basis& basis, Basis& rows,
+                  unsigned begin, unsigned end, unsigned* permutation)
+      {
+        that->r_reduce_rows(basis, rows, begin, end, permutation);
+      }
+
+      template <typename Reduc, typename Basis, typename Vector>
+      static void
+      vector_in_new_basis(Reduc* that, Basis& basis,
+                          Vector& current, Vector& new_vector,
+                          unsigned* permutation)
+      {
+        that->read_vector_in_new_basis(basis, current, new_vector,
+                                       permutation);
+      }
     };
 
     template <>
     struct select<z> : select<void>
     {
+      static constexpr bool modifies_basis = true;
+
       template <typename Reduc, typename Vector>
       static unsigned
       find_pivot(Reduc* that, const Vector& v,
@@ -167,6 +287,14 @@ namespace vcsn
         that->z_reduce_vector(vbasis, current, b, permutation);
       }
 
+      template <typename Reduc, typename Basis>
+      static void
+      reduce_rows(Reduc* that, Basis& basis, Basis& rows,
+                  unsigned begin, unsigned end, unsigned* permutation)
+      {
+        that->z_reduce_rows(basis, rows, begin, end, permutation);
+      }
+
       template <typename Reduc, typename Vector>
       static void normalisation_vector(Reduc*, Vector&, unsigned, unsigned*)
       {}
@@ -185,6 +313,10 @@ namespace vcsn
       }
     };
 
+    template <>
+    struct select<zh> : select<z>
+    {};
+
     template <Automaton Aut>
     class left_reductioner
     {
@@ -200,19 +332,30 @@ namespace vcsn
       using output_state_t = state_t_of<output_automaton_t>;
       using weight_t = typename context_t::weight_t;
       using vector_t = std::vector<weight_t>;
-      using matrix_t = std::vector<std::map<std::size_t, weight_t>>;
-      using matrix_set_t = std::map<label_t, matrix_t>;
+      /// A sparse matrix, in compressed rows: the entries of row i
+      /// are entries[offsets[i]] to entries[offsets[i + 1]].
+      struct matrix_t
+      {
+        std::vector<unsigned> offsets;
+        std::vector<std::pair<unsigned, weight_t>> entries;
+      };
+      /// The matrix of each letter, in increasing order of labels.
+      using matrix_set_t = std::vector<std::pair<label_t, matrix_t>>;
 
     public:
-      left_reductioner(const automaton_t& input)
+      /// \param input        the automaton to reduce
+      /// \param num_threads  the number of threads to use
+      ///                     (0 for the number of hardware threads)
+      left_reductioner(const automaton_t& input, unsigned num_threads = 0)
         : input_(input)
         , res_(make_fresh_automaton(input))
+        , num_threads_(detail::num_threads(num_threads))
       {}
 
       /// Create the linear representation of the input
       void linear_representation()
       {
-        auto state_to_index = std::unordered_map<state_t, unsigned>{};
+        auto state_to_index = std::vector<unsigned>(states_size(input_));
         unsigned i = 0;
         for (auto s: input_->states())
           state_to_index[s] = i++;
@@ -227,15 +370,40 @@ namespace vcsn
         // Computation of the final_ vector.
         for (auto t : final_transitions(input_))
           final_[state_to_index[input_->src_of(t)]] = input_->weight_of(t);
-        // For each letter, we define an adjency matrix.
+        // For each letter, we define an adjency matrix: count the
+        // entries of each row, then fill them.
+        auto letters = std::map<label_t, unsigned>{};
+        for (auto t : transitions(input_))
+          letters.emplace(input_->label_of(t), 0);
+        for (auto& l: letters)
+          {
+            l.second = letter_matrix_set_.size();
+            letter_matrix_set_.emplace_back
+              (l.first,
+               matrix_t{std::vector<unsigned>(dimension_ + 1), {}});
+          }
         for (auto t : transitions(input_))
           {
-            auto it = letter_matrix_set_.find(input_->label_of(t));
-            if (it == letter_matrix_set_.end())
-              it = letter_matrix_set_.emplace(input_->label_of(t),
-                                             matrix_t(dimension_)).first;
-            it->second[state_to_index[input_->src_of(t)]]
-              [state_to_index[input_->dst_of(t)]] = input_->weight_of(t);
+            auto& m = letter_matrix_set_[letters[input_->label_of(t)]].second;
+            ++m.offsets[state_to_index[input_->src_of(t)] + 1];
+          }
+        for (auto& l: letter_matrix_set_)
+          {
+            auto& m = l.second;
+            for (unsigned r = 0; r < dimension_; ++r)
+              m.offsets[r + 1] += m.offsets[r];
+            m.entries.resize(m.offsets[dimension_]);
+          }
+        auto next = std::vector<std::vector<unsigned>>{};
+        for (const auto& l: letter_matrix_set_)
+          next.emplace_back(l.second.offsets);
+        for (auto t : transitions(input_))
+          {
+            auto l = letters[input_->label_of(t)];
+            auto& m = letter_matrix_set_[l].second;
+            auto src = state_to_index[input_->src_of(t)];
+            m.entries[next[l][src]++]
+              = {state_to_index[input_->dst_of(t)], input_->weight_of(t)};
           }
       }
 
@@ -247,11 +415,23 @@ namespace vcsn
                                  vector_t& res)
       {
         for (unsigned i = 0; i < dimension_; i++)
-          for (auto it : m[i])
-            {
-              unsigned j = it.first;
-              res[j] = ws_.add(res[j], ws_.mul(v[i], it.second));
-            }
+          if (!ws_.is_zero(v[i]))
+            for (unsigned e = m.offsets[i]; e < m.offsets[i + 1]; ++e)
+              {
+                unsigned j = m.entries[e].first;
+                res[j] = ws_.add(res[j], ws_.mul(v[i], m.entries[e].second));
+              }
+      }
+
+      /// The number of rows per task when processing independent rows
+      /// that require about \a work operations each, so that the
+      /// tasks are worth a thread.
+      size_t rows_grain(size_t work) const
+      {
+        // Operations on rationals are much more costly than on floats.
+        const size_t cost = std::is_same<weightset_t, r>::value ? 1 : 64;
+        return std::max(size_t{1},
+                        (size_t{1} << 18) / std::max(size_t{1}, work * cost));
       }
 
       /// Computes the scalar product of two vectors.
@@ -266,6 +446,7 @@ namespace vcsn
 
       ///  Specializations for Q and R.
       using z_weight_t = vcsn::detail::z_impl::value_t; // int or long
+      using zh_weight_t = vcsn::detail::zh_impl::value_t;
       using q_weight_t = vcsn::detail::q_impl::value_t;
       using r_weight_t = vcsn::detail::r_impl::value_t; // = double
 
@@ -296,6 +477,12 @@ namespace vcsn
         return abs(w);
       }
 
+      /// Norm for hybrid integers.
+      static weight_t norm(const zh_weight_t& w)
+      {
+        return zh_impl::abs(w);
+      }
+
       // Works for both Q and R.
       unsigned
       find_pivot_by_norm(const vector_t& v, unsigned begin,
@@ -317,41 +504,57 @@ namespace vcsn
       // End of Q/R specializations.
 
 
-      // Specialization for Z.
+      // Specialization for Z and ZH.
+
+      /// The quotient of \a x by \a y, rounded towards zero.
+      static z_weight_t quotient(z_weight_t x, z_weight_t y)
+      {
+        return x / y;
+      }
+
+      static zh_weight_t quotient(const zh_weight_t& x, const zh_weight_t& y)
+      {
+        // Beware of min / -1.
+        if (x.is_small() && y.is_small() && y.small() != -1)
+          return x.small() / y.small();
+        else
+          return mpz_class{x.get_mpz() / y.get_mpz()};
+      }
 
       // Gcd function that also computes the Bezout coefficients.
       // Used in the z reduction.
-      static z_weight_t
-      gcd(z_weight_t x, z_weight_t y, z_weight_t& a, z_weight_t& b)
+      weight_t
+      gcd(weight_t x, weight_t y, weight_t& a, weight_t& b) const
       {
-        z_weight_t res = 0;
+        weight_t res;
         //gcd = ax + by
-        if (y == 0)
+        if (ws_.is_zero(y))
           {
-            a = 1;
-            b = 0;
+            a = ws_.one();
+            b = ws_.zero();
             res = x;
           }
-        else if (x < 0)
+        else if (ws_.less(x, ws_.zero()))
           {
-            res = gcd(-x, y, a, b);
-            a = -a;
+            res = gcd(ws_.sub(ws_.zero(), x), y, a, b);
+            a = ws_.sub(ws_.zero(), a);
           }
-        else if (y < 0)
+        else if (ws_.less(y, ws_.zero()))
           {
-            res = gcd(x, -y, a, b);
-            b = -b;
+            res = gcd(x, ws_.sub(ws_.zero(), y), a, b);
+            b = ws_.sub(ws_.zero(), b);
           }
-        else if (x < y)
+        else if (ws_.less(x, y))
           res = gcd(y, x, b, a);
         else
           {
-            z_weight_t z = x % y;  // z= x- (x/y)*y;
+            weight_t q = quotient(x, y);
+            weight_t z = ws_.sub(x, ws_.mul(q, y));  // z= x- (x/y)*y;
             res = gcd(y, z, b, a);
             //res=by+az = (b-a(x/y)) y + ax
-            b -= a * (x / y);
+            b = ws_.sub(b, ws_.mul(a, q));
           }
-        assert(res == a * x + b * y);
+        assert(ws_.equal(res, ws_.add(ws_.mul(a, x), ws_.mul(b, y))));
         return res;
       }
 
@@ -372,13 +575,17 @@ namespace vcsn
         weight_t cp = current[pivot];
         weight_t a,b;
         weight_t g = gcd(bp, cp, a, b);
-        bp /= g;
-        cp /= g;
+        bp = ws_.rdivide(bp, g);
+        cp = ws_.rdivide(cp, g);
         for (unsigned i = nb; i < dimension_; ++i)
           {
             weight_t tmp = current[permutation[i]];
-            current[permutation[i]] = bp*tmp - cp*vbasis[permutation[i]];
-            vbasis[permutation[i]] = a*vbasis[permutation[i]] + b*tmp;
+            current[permutation[i]]
+              = ws_.sub(ws_.mul(bp, tmp),
+                        ws_.mul(cp, vbasis[permutation[i]]));
+            vbasis[permutation[i]]
+              = ws_.add(ws_.mul(a, vbasis[permutation[i]]),
+                        ws_.mul(b, tmp));
           }
       }
 
@@ -390,17 +597,262 @@ namespace vcsn
           {
             vector_t& vbasis = basis[b];
             unsigned pivot = permutation[b]; //pivot of vector vbasis
-            new_vector[b] = current[pivot] / vbasis[pivot];
+            // Not necessarily exact: truncate, as does integer division.
+            new_vector[b] = quotient(current[pivot], vbasis[pivot]);
             if (!ws_.is_zero(new_vector[b]))
               {
                 current[pivot] = ws_.zero();
                 for (unsigned i = b+1; i < dimension_; ++i)
                   current[permutation[i]]
-                    -= new_vector[b] * vbasis[permutation[i]];
+                    = ws_.sub(current[permutation[i]],
+                              ws_.mul(new_vector[b], vbasis[permutation[i]]));
               }
           }
       }
-      // End of Z specializations.
+
+      /// Reduce the \a rows w.r.t. the vectors of the basis in
+      /// [begin, end).  Sequential, since the basis is modified.
+      void z_reduce_rows(std::vector<vector_t>& basis,
+                         std::vector<vector_t>& rows,
+                         unsigned begin, unsigned end,
+                         unsigned* permutation)
+      {
+        for (auto& current: rows)
+          for (unsigned b = begin; b < end; ++b)
+            z_reduce_vector(basis[b], current, b, permutation);
+      }
+      // End of Z and ZH specializations.
+
+
+      // Specializations for QMP and QH: fraction-free elimination.
+      //
+      // A rational vector v is represented by an integral vector c
+      // and a scale k such that v = c / k.  Eliminating an entry
+      // requires only products of integers (and one gcd), instead of
+      // the normalizations of rational arithmetics.
+
+      using int_vector_t = std::vector<mpz_class>;
+
+      static const mpq_class& to_mpq(const mpq_class& w)
+      {
+        return w;
+      }
+
+      static mpq_class to_mpq(const qh_impl::value_t& w)
+      {
+        return w.get_mpq();
+      }
+
+      static const mpq_class& from_mpq(const qmp&, const mpq_class& w)
+      {
+        return w;
+      }
+
+      static qh_impl::value_t from_mpq(const qh&, const mpq_class& w)
+      {
+        return w;
+      }
+
+      /// The integral vector c, and its \a scale k, for \a v = c / k.
+      int_vector_t to_integers(const vector_t& v, mpq_class& scale) const
+      {
+        auto den = mpz_class{1};
+        for (const auto& w: v)
+          if (!ws_.is_zero(w))
+            mpz_lcm(den.get_mpz_t(), den.get_mpz_t(),
+                    to_mpq(w).get_den_mpz_t());
+        auto res = int_vector_t(dimension_);
+        for (unsigned i = 0; i < dimension_; ++i)
+          if (!ws_.is_zero(v[i]))
+            {
+              const auto& w = to_mpq(v[i]);
+              mpz_divexact(res[i].get_mpz_t(),
+                           den.get_mpz_t(), w.get_den_mpz_t());
+              res[i] *= w.get_num();
+            }
+        scale = den;
+        return res;
+      }
+
+      /// Store c / \a scale in \a res.
+      void from_integers(const int_vector_t& c, const mpq_class& scale,
+                         vector_t& res) const
+      {
+        for (unsigned i = 0; i < dimension_; ++i)
+          if (sgn(c[i]))
+            res[i] = from_mpq(ws_, mpq_class{c[i] / scale});
+          else
+            res[i] = ws_.zero();
+      }
+
+      /// Divide \a c by the gcd of its entries.
+      static void remove_content(int_vector_t& c, mpq_class& scale)
+      {
+        auto g = mpz_class{0};
+        for (const auto& x: c)
+          if (sgn(x))
+            {
+              mpz_gcd(g.get_mpz_t(), g.get_mpz_t(), x.get_mpz_t());
+              if (g == 1)
+                return;
+            }
+        if (1 < g)
+          {
+            for (auto& x: c)
+              if (sgn(x))
+                mpz_divexact(x.get_mpz_t(), x.get_mpz_t(), g.get_mpz_t());
+            scale /= g;
+          }
+      }
+
+      /*
+        Make current[pivot] zero, where pivot is the pivot of vbasis:
+        with g = gcd(vbasis[pivot], current[pivot]),
+        current := (vbasis[pivot]/g).current - (current[pivot]/g).vbasis
+        This is the same vector as in the rational reduction, up to
+        the factor vbasis[pivot]/g, which is applied to the scale.
+      */
+      void q_reduce_integers(const int_vector_t& vbasis, unsigned pivot,
+                             int_vector_t& current, mpq_class& scale) const
+      {
+        if (!sgn(current[pivot]))
+          return;
+        auto g = mpz_class{};
+        mpz_gcd(g.get_mpz_t(),
+                vbasis[pivot].get_mpz_t(), current[pivot].get_mpz_t());
+        auto bp = mpz_class{vbasis[pivot] / g};
+        auto cp = mpz_class{current[pivot] / g};
+        for (unsigned i = 0; i < dimension_; ++i)
+          if (sgn(vbasis[i]))
+            {
+              auto x = current[i].get_mpz_t();
+              mpz_mul(x, x, bp.get_mpz_t());
+              mpz_submul(x, cp.get_mpz_t(), vbasis[i].get_mpz_t());
+            }
+          else if (sgn(current[i]))
+            current[i] *= bp;
+        scale *= bp;
+        remove_content(current, scale);
+      }
+
+      /// The integral vectors of the basis vectors up to \a end.
+      void q_integer_basis(const std::vector<vector_t>& basis, unsigned end)
+      {
+        auto scale = mpq_class{};
+        for (unsigned b = int_basis_.size(); b < end; ++b)
+          int_basis_.emplace_back(to_integers(basis[b], scale));
+      }
+
+      void q_reduce_rows(std::vector<vector_t>& basis,
+                         std::vector<vector_t>& rows,
+                         unsigned begin, unsigned end,
+                         unsigned* permutation)
+      {
+        q_integer_basis(basis, end);
+        detail::parallel_for
+          (rows.size(), num_threads_,
+           [&](size_t r)
+           {
+             auto scale = mpq_class{};
+             auto current = to_integers(rows[r], scale);
+             bool reduced = false;
+             for (unsigned b = begin; b < end; ++b)
+               if (sgn(current[permutation[b]]))
+                 {
+                   q_reduce_integers(int_basis_[b], permutation[b],
+                                     current, scale);
+                   reduced = true;
+                 }
+             if (reduced)
+               from_integers(current, scale, rows[r]);
+           },
+           rows_grain((end - begin) * dimension_));
+      }
+
+      void q_bottom_up_reduction(std::vector<vector_t>& basis,
+                                 unsigned* permutation)
+      {
+        q_integer_basis(basis, basis.size());
+        auto& ints = int_basis_;
+        // The pivot of each (normalized) vector of the basis is 1.
+        auto scales = std::vector<mpq_class>(basis.size());
+        for (unsigned b = 0; b < basis.size(); ++b)
+          scales[b] = ints[b][permutation[b]];
+        auto reduced = std::vector<char>(basis.size());
+        for (unsigned b = basis.size()-1; 0 < b; --b)
+          detail::parallel_for
+            (b, num_threads_,
+             [&](size_t c)
+             {
+               if (sgn(ints[c][permutation[b]]))
+                 {
+                   q_reduce_integers(ints[b], permutation[b],
+                                     ints[c], scales[c]);
+                   reduced[c] = true;
+                 }
+             },
+             rows_grain(dimension_));
+        for (unsigned b = 0; b < basis.size(); ++b)
+          if (reduced[b])
+            from_integers(ints[b], scales[b], basis[b]);
+        int_basis_.clear();
+      }
+      // End of QMP and QH specializations.
+
+
+      // Specialization for R.
+
+      /// Same as reduce_vector, on the whole vector, since the
+      /// entries before the pivot (w.r.t. the permutation) are zero
+      /// in vbasis.  The loop is unrolled, with the loads before the
+      /// stores, so that the compiler can use vector instructions.
+      weight_t r_reduce_vector(const vector_t& vbasis,
+                               vector_t& current, unsigned b,
+                               unsigned* permutation)
+      {
+        unsigned pivot = permutation[b]; //pivot of vector vbasis
+        weight_t ratio = current[pivot];//  vbasis[pivot] is one
+        if (ws_.is_zero(ratio))
+          return ratio;
+        const auto* v = vbasis.data();
+        auto* c = current.data();
+        unsigned i = 0;
+        for (; i + 4 <= dimension_; i += 4)
+          {
+            weight_t v0 = v[i], v1 = v[i + 1], v2 = v[i + 2], v3 = v[i + 3];
+            weight_t c0 = c[i], c1 = c[i + 1], c2 = c[i + 2], c3 = c[i + 3];
+            c[i] = c0 - ratio * v0;
+            c[i + 1] = c1 - ratio * v1;
+            c[i + 2] = c2 - ratio * v2;
+            c[i + 3] = c3 - ratio * v3;
+          }
+        for (; i < dimension_; ++i)
+          c[i] -= ratio * v[i];
+        c[pivot] = ws_.zero();
+        return ratio;
+      }
+
+      /// Same as reduce_rows, by blocks of rows: each vector of the
+      /// basis is loaded once per block, instead of once per row.
+      void r_reduce_rows(std::vector<vector_t>& basis,
+                         std::vector<vector_t>& rows,
+                         unsigned begin, unsigned end,
+                         unsigned* permutation)
+      {
+        constexpr size_t block = 8;
+        detail::parallel_for
+          ((rows.size() + block - 1) / block, num_threads_,
+           [&](size_t k)
+           {
+             auto last = std::min(rows.size(), (k + 1) * block);
+             for (unsigned b = begin; b < end; ++b)
+               for (auto r = k * block; r < last; ++r)
+                 r_reduce_vector(basis[b], rows[r], b, permutation);
+           },
+           std::max(size_t{1},
+                    rows_grain((end - begin) * dimension_) / block));
+      }
+      // End of R specializations.
 
      /* Generic subroutines.
          These methods are written for any (skew) field.
@@ -457,14 +909,55 @@ namespace vcsn
           }
       }
 
+      /// Reduce the \a rows w.r.t. the vectors of the basis in
+      /// [begin, end).  The rows are independent, and processed in
+      /// parallel.
+      void reduce_rows(std::vector<vector_t>& basis,
+                       std::vector<vector_t>& rows,
+                       unsigned begin, unsigned end,
+                       unsigned* permutation)
+      {
+        using type_t = select<weightset_t>;
+        detail::parallel_for
+          (rows.size(), num_threads_,
+           [&](size_t r)
+           {
+             for (unsigned b = begin; b < end; ++b)
+               type_t::reduce_vector(this, basis[b], rows[r], b, permutation);
+           },
+           rows_grain((end - begin) * dimension_));
+      }
+
+      /// Reduce \a current w.r.t. the vectors of the basis in
+      /// [begin, end).
+      void reduce_row(std::vector<vector_t>& basis, vector_t& current,
+                      unsigned begin, unsigned end, unsigned* permutation)
+      {
+        if (begin < end)
+          {
+            auto rows = std::vector<vector_t>(1);
+            rows[0].swap(current);
+            select<weightset_t>::reduce_rows(this, basis, rows,
+                                             begin, end, permutation);
+            rows[0].swap(current);
+          }
+      }
+
       /// Apply reduction to vectors of the basis to maximize the
       /// number of zeros.
       void bottom_up_reduction(std::vector<vector_t>& basis,
                                unsigned* permutation)
       {
+        using type_t = select<weightset_t>;
         for (unsigned b = basis.size()-1; 0 < b; --b)
-          for (unsigned c = 0; c < b; ++c)
-            reduce_vector(basis[b], basis[c], b, permutation);
+          detail::parallel_for
+            (b, num_threads_,
+             [&](size_t c)
+             {
+               type_t::reduce_vector(this, basis[b], basis[c], b,
+                                     permutation);
+             },
+             rows_grain(dimension_));
       }
 
       /// Compute the coordinate of a vector in the new basis.
@@ -476,6 +969,17 @@ namespace vcsn
           new_vector[b] = reduce_vector(basis[b], current, b, permutation);
       }
 
+      /// Compute the coordinate of a vector in the new basis, once
+      /// bottom-up reduced: the basis is in reduced echelon form, so
+      /// the coordinates are the entries at the pivots.
+      void read_vector_in_new_basis(std::vector<vector_t>& basis,
+                                    vector_t& current, vector_t& new_vector,
+                                    unsigned* permutation)
+      {
+        for (unsigned b = 0; b < basis.size(); ++b)
+          new_vector[b] = current[permutation[b]];
+      }
+
       /** Core algorithm
           This algorithm computes a basis of I.mu(w).
           The basis is scaled.
@@ -496,7 +1000,8 @@ namespace vcsn
         // The permutation array corresponds to a permutation of the indices
         // (i.e. the columns of the matrices) such that permtuation[k]
         // is the pivot of the k-th vector of the basis.
-        unsigned permutation[dimension_];
+        auto perm = std::vector<unsigned>(dimension_);
+        unsigned* permutation = perm.data();
         for (unsigned i = 0; i < dimension_; ++i)
           permutation[i] = i;
         // If the initial vector is null, the function immediatly returns
@@ -517,29 +1022,54 @@ namespace vcsn
         // computed, reduced to respect to the basis, and finally, if
         // linearly independant, pushed at the end of the basis
         // itself.
-        for (unsigned nb = 0; nb < basis.size(); ++nb)
-          // All the vectors basis[nb].mu(a) are processed
-          for (auto mu : letter_matrix_set_) //mu is a pair (letter,matrix)
-            {
-              auto current = vector_t(dimension_);
-              product_vector_matrix(basis[nb], mu.second, current);
-              //reduction of current w.r.t each basis vector;
-              for (unsigned b = 0; b < basis.size(); ++b)
-                type_t::reduce_vector(this, basis[b],
-                                      current, b, permutation);
-              // After reduction, we put current in the basis if it is
-              // not null and we search for the pivot of current.
-              pivot = type_t::find_pivot(this, current, basis.size(),
-                                         permutation);
-              if (pivot != dimension_) //otherwise, current is null
-                {
-                  if (pivot != basis.size())
-                    std::swap(permutation[pivot], permutation[basis.size()]);
-                  type_t::normalisation_vector(this, current,
-                                               basis.size(), permutation);
-                  basis.push_back(current);
-                }
-            }
+        //
+        // The successors are processed by batches of rows: they are
+        // first all reduced w.r.t. the vectors that are in the basis,
+        // then one at a time w.r.t. the vectors added since.  Bound
+        // the size of the batches; in Z, the reduction modifies the
+        // basis, so the successors are computed one at a time.
+        const size_t num_letters = letter_matrix_set_.size();
+        const size_t batch
+          = type_t::modifies_basis
+          ? 1
+          : std::max(size_t{1}, (size_t{1} << 22) / dimension_);
+        auto rows = std::vector<vector_t>{};
+        // Row number r is basis[r / num_letters].mu(r % num_letters).
+        for (size_t r = 0; r < basis.size() * num_letters;)
+          {
+            size_t last = std::min(r + batch, basis.size() * num_letters);
+            unsigned end = basis.size();
+            rows.clear();
+            for (; r < last; ++r)
+              {
+                rows.emplace_back(dimension_);
+                product_vector_matrix(basis[r / num_letters],
+                                      letter_matrix_set_[r % num_letters]
+                                        .second,
+                                      rows.back());
+              }
+            //reduction of the rows w.r.t each basis vector;
+            type_t::reduce_rows(this, basis, rows, 0, end, permutation);
+            for (auto& current: rows)
+              {
+                // Reduction w.r.t. the vectors added since.
+                reduce_row(basis, current, end, basis.size(), permutation);
+                // After reduction, we put current in the basis if it is
+                // not null and we search for the pivot of current.
+                pivot = type_t::find_pivot(this, current, basis.size(),
+                                           permutation);
+                if (pivot != dimension_) //otherwise, current is null
+                  {
+                    if (pivot != basis.size())
+                      std::swap(permutation[pivot],
+                                permutation[basis.size()]);
+                    type_t::normalisation_vector(this, current,
+                                                 basis.size(), permutation);
+                    basis.push_back(std::move(current));
+                  }
+              }
+          }
+        rows.clear();
 
         // now, we use each vector to reduce the preceding vectors in
         // the basis.  If weightset=Z we do not do it.
@@ -557,24 +1087,43 @@ namespace vcsn
         for (unsigned b = 0; b < basis.size(); ++b)
           res_->set_initial(states[b], vect_new_basis[b]);
         // 3. Each vector of the basis is a state; computation of the
-        // final function and the successor function
+        // final function and the successor function.  The vectors
+        // are independent: they are processed in parallel, and the
+        // transitions are created afterwards, in order.
+        auto finals = vector_t(basis.size());
+        // Index of the letter, destination, weight.
+        using succ_t = std::tuple<unsigned, unsigned, weight_t>;
+        auto succs = std::vector<std::vector<succ_t>>(basis.size());
+        detail::parallel_for
+          (basis.size(), num_threads_,
+           [&](size_t v)
+           {
+             finals[v] = scalar_product(basis[v], final_);
+             auto current = vector_t(dimension_);
+             auto coords = vector_t(basis.size());
+             for (unsigned l = 0; l < letter_matrix_set_.size(); ++l)
+               {
+                 std::fill(current.begin(), current.end(), ws_.zero());
+                 product_vector_matrix(basis[v],
+                                       letter_matrix_set_[l].second,
+                                       current);
+                 type_t::vector_in_new_basis(this, basis, current,
+                                             coords, permutation);
+                 for (unsigned b = 0; b < basis.size(); ++b)
+                   if (!ws_.is_zero(coords[b]))
+                     succs[v].emplace_back(l, b, coords[b]);
+               }
+           },
+           rows_grain(num_letters * (dimension_ + basis.size())));
         for (unsigned v = 0; v < basis.size(); ++v)
           {
-            weight_t k = scalar_product(basis[v],final_);
-            if(!ws_.is_zero(k))
-              res_->set_final(states[v],k);
-            for (auto mu : letter_matrix_set_)
-              {
-                // mu is a pair (letter,matrix).
-                auto current = vector_t(dimension_);
-                product_vector_matrix(basis[v], mu.second, current);
-                type_t::vector_in_new_basis(this, basis, current,
-                                            vect_new_basis, permutation);
-                for (unsigned b = 0; b < basis.size(); ++b)
-                  res_->new_transition(states[v], states[b],
-                                       mu.first, vect_new_basis[b]);
-              }
-        }
+            if (!ws_.is_zero(finals[v]))
+              res_->set_final(states[v], finals[v]);
+            for (const auto& s: succs[v])
+              res_->new_transition(states[v], states[std::get<1>(s)],
+                                   letter_matrix_set_[std::get<0>(s)].first,
+                                   std::get<2>(s));
+          }
         return res_;
       }
 
@@ -589,26 +1138,40 @@ namespace vcsn
       vector_t init_;
       vector_t final_;
       matrix_set_t letter_matrix_set_;
+
+      /// The number of threads.
+      unsigned num_threads_;
+      /// QMP and QH: the integral vectors of the basis.  Nothing for
+      /// the other weightsets, which must not depend on GMP.
+      std::conditional_t<std::is_base_of<select_rational,
+                                         select<weightset_t>>{},
+                         std::vector<int_vector_t>, std::tuple<>>
+        int_basis_;
     };
 
   }
 
+  /// \param input        the automaton to reduce
+  /// \param num_threads  the number of threads to use
+  ///                     (0 for the number of hardware threads)
   template <Automaton Aut>
   auto
-  left_reduce(const Aut& input)
+  left_reduce(const Aut& input, unsigned num_threads = 0)
     -> decltype(copy(input))
   {
-    detail::left_reductioner<Aut> left_reduce(input);
+    detail::left_reductioner<Aut> left_reduce(input, num_threads);
     return left_reduce();
   }
 
 
   template <Automaton Aut>
   auto
-  reduce(const Aut& input)
+  reduce(const Aut& input, unsigned num_threads = 0)
     -> decltype(copy(input))
   {
-    return left_reduce(transpose(left_reduce(transpose(input))));
+    return left_reduce(transpose(left_reduce(transpose(input),
+                                             num_threads)),
+                       num_threads);
   }
 
   namespace dyn
@@ -1,11 +1,12 @@
 #pragma once
 
-#include <iterator> // std::rbegin
+#include <algorithm> // max
 #include <limits>
+#include <numeric> // partial_sum
 #include <stack>
+#include <vector>
 
-#include <boost/range/rbegin.hpp>
-#include <boost/range/rend.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #include <vcsn/algos/copy.hh> // make_fresh_automaton
 #include <vcsn/algos/filter.hh>
@@ -16,6 +17,7 @@
 #include <vcsn/dyn/fwd.hh>
 #include <vcsn/misc/builtins.hh>
 #include <vcsn/misc/getargs.hh>
+#include <vcsn/misc/parallel.hh>
 #include <vcsn/misc/unordered_map.hh>
 #include <vcsn/misc/unordered_set.hh>
 #include <vcsn/misc/vector.hh> // has
@@ -44,6 +46,96 @@ namespace vcsn
     template <Automaton Aut>
     using components_t = std::vector<component_t<Aut>>;
 
+    /// A set of strongly-connected components, stored contiguously.
+    ///
+    /// The states of all the components are in a single array, the
+    /// component number `i` being the range `[offsets[i],
+    /// offsets[i+1])` of this array.  Contrary to components_t, there
+    /// is no allocation per component, and enumerating the states is
+    /// a linear scan.
+    template <Automaton Aut>
+    class scc_table
+    {
+    public:
+      using state_t = state_t_of<Aut>;
+      using states_t = std::vector<state_t>;
+      /// A component: a range of states.
+      using component_t
+        = boost::iterator_range<typename states_t::const_iterator>;
+
+      /// The number of components.
+      size_t size() const
+      {
+        return offsets_.size() - 1;
+      }
+
+      bool empty() const
+      {
+        return size() == 0;
+      }
+
+      /// The states of component number \a i.
+      component_t operator[](size_t i) const
+      {
+        return {states_.begin() + offsets_[i],
+                states_.begin() + offsets_[i + 1]};
+      }
+
+      /// Add \a s to the component being built.
+      void add_state(state_t s)
+      {
+        states_.emplace_back(s);
+      }
+
+      /// Complete the component being built.
+      void close_component()
+      {
+        offsets_.emplace_back(states_.size());
+      }
+
+      /// All the states, component after component.
+      const states_t& states() const
+      {
+        return states_;
+      }
+
+      /// Where each component starts, plus the total number of states.
+      const std::vector<size_t>& offsets() const
+      {
+        return offsets_;
+      }
+
+      /// The components as sets of states.
+      components_t<Aut> components() const
+      {
+        auto res = components_t<Aut>{};
+        res.reserve(size());
+        for (size_t i = 0; i < size(); ++i)
+          {
+            auto c = (*this)[i];
+            res.emplace_back(c.begin(), c.end());
+          }
+        return res;
+      }
+
+      /// Build from sets of states.
+      static scc_table from_components(const components_t<Aut>& cs)
+      {
+        auto res = scc_table{};
+        for (const auto& c: cs)
+          {
+            for (auto s: c)
+              res.add_state(s);
+            res.close_component();
+          }
+        return res;
+      }
+
+    private:
+      states_t states_;
+      std::vector<size_t> offsets_ = {0};
+    };
+
 
     /*---------------------.
     | reverse_postorder.   |
@@ -297,18 +389,38 @@ namespace vcsn
 
       scc_impl(const Aut& aut)
         : aut_{aut}
+        , number_(states_size(aut_), unvisited_)
+        , low_(states_size(aut_))
       {
         for (auto s : aut_->states())
-          if (!has(number_, s))
+          if (!visited_(s))
             dfs(s);
       }
 
-      const components_t& components() const
+      /// The components, contiguously.
+      const scc_table<Aut>& table() const
       {
         return components_;
       }
 
+      components_t components() const
+      {
+        return components_.components();
+      }
+
     private:
+      /// Whether \a s was visited.  Lazy automata may have more
+      /// states than at construction.
+      bool visited_(state_t s)
+      {
+        if (number_.size() <= s)
+          {
+            number_.resize(s + 1, unvisited_);
+            low_.resize(s + 1);
+          }
+        return number_[s] != unvisited_;
+      }
+
       void dfs(state_t s)
       {
         number_[s] = low_[s] = curr_state_num_++;
@@ -322,7 +434,7 @@ namespace vcsn
               {
                 auto dst = aut_->dst_of(*st.pos);
                 ++st.pos;
-                if (!has(number_, dst))
+                if (!visited_(dst))
                   {
                     number_[dst] = low_[dst] = curr_state_num_++;
                     const auto& ts = out(aut_, dst);
@@ -336,17 +448,16 @@ namespace vcsn
               {
                 if (low_[src] == number_[src])
                   {
-                    components_.emplace_back();
-                    auto& com = components_.back();
                     state_t w;
                     do
                       {
                         w = stack_.back();
                         stack_.pop_back();
-                        com.emplace(w);
+                        components_.add_state(w);
                         low_[w] = low_max_;
                       }
                     while (w != src);
+                    components_.close_component();
                   }
                 dfs_stack_.pop_back();
                 if (!dfs_stack_.empty())
@@ -368,17 +479,20 @@ namespace vcsn
 
       /// The current visited state.
       std::size_t curr_state_num_ = 0;
-      /// Store the visit order of each state.
-      std::unordered_map<state_t, std::size_t> number_;
+      /// The number of the states not visited yet.
+      static constexpr std::size_t unvisited_
+        = std::numeric_limits<std::size_t>::max();
+      /// Store the visit order of each state, indexed by state.
+      std::vector<std::size_t> number_;
       /// low_[s] is minimum of state that it can go.
-      std::unordered_map<state_t, std::size_t> low_;
+      std::vector<std::size_t> low_;
       /// the maximum possible of a value in low_.
       std::size_t low_max_ = std::numeric_limits<unsigned int>::max();
 
       /// List of states in the same the component.
       std::vector<state_t> stack_;
       /// All components.
-      components_t components_;
+      scc_table<Aut> components_;
 
       /// Iterator on outgoing transitions.
       using iterator_t = decltype(out(aut_, state_t{}).begin());
@@ -394,6 +508,10 @@ namespace vcsn
         iterator_t end;
       };
     };
+
+    template <Automaton Aut>
+    constexpr std::size_t
+    scc_impl<Aut, tarjan_iterative_tag>::unvisited_;
   }
 
   /*--------------------.
@@ -486,6 +604,396 @@ namespace vcsn
     };
   }
 
+  /*--------------------.
+  | forward-backward.   |
+  `--------------------*/
+
+  /// Request the forward-backward algorithm to compute the SCCs,
+  /// using several threads.
+  struct forward_backward_tag {};
+
+  namespace detail
+  {
+    /// The forward-backward algorithm to find all strongly connected
+    /// components, with trimming.
+    ///
+    /// The automaton is first copied into a compact adjacency array
+    /// (both directions).  Then the states are split in subproblems,
+    /// sets of states that are unions of components.  To split a
+    /// subproblem, first remove (trim) the states with no predecessor
+    /// or no successor inside it: they are singleton components.
+    /// Then pick a pivot: the states both reachable from it and
+    /// co-reachable from it form its component, and the states
+    /// reachable only, co-reachable only, and neither, form three
+    /// new subproblems.
+    ///
+    /// The subproblems are independent: they are processed
+    /// concurrently, in rounds.  The results do not depend on the
+    /// number of threads.
+    ///
+    /// See "On identifying strongly connected components in parallel",
+    /// Fleischer, Hendrickson and Pinar, IPDPS Workshops, 2000.
+    template <Automaton Aut>
+    class scc_impl<Aut, forward_backward_tag>
+    {
+    public:
+      using state_t = state_t_of<Aut>;
+      using component_t = detail::component_t<Aut>;
+      using components_t = detail::components_t<Aut>;
+
+      /// \param aut          the automaton
+      /// \param num_threads  the number of threads, 0 for as many as
+      ///                     supported by the hardware.
+      scc_impl(const Aut& aut, unsigned num_threads = 0)
+        : aut_{aut}
+      {
+        build_();
+        solve_(num_threads);
+      }
+
+      /// The components, contiguously.
+      const scc_table<Aut>& table() const
+      {
+        return components_;
+      }
+
+      components_t components() const
+      {
+        return components_.components();
+      }
+
+    private:
+      /// Vertices: the states renumbered contiguously.
+      using vertex_t = unsigned;
+      using vertices_t = std::vector<vertex_t>;
+
+      /// Build the adjacency arrays.
+      void build_()
+      {
+        auto index = std::vector<vertex_t>{};
+        auto num_edges = size_t{0};
+        for (auto s : aut_->states())
+          {
+            if (index.size() <= s)
+              index.resize(s + 1);
+            index[s] = states_.size();
+            states_.emplace_back(s);
+          }
+        const auto size = states_.size();
+        auto outs = std::vector<size_t>(size + 1);
+        auto ins = std::vector<size_t>(size + 1);
+        for (vertex_t v = 0; v < size; ++v)
+          for (auto t : out(aut_, states_[v]))
+            {
+              ++outs[v + 1];
+              ++ins[index[aut_->dst_of(t)] + 1];
+              ++num_edges;
+            }
+        std::partial_sum(outs.begin(), outs.end(), outs.begin());
+        std::partial_sum(ins.begin(), ins.end(), ins.begin());
+        succ_offsets_ = outs;
+        pred_offsets_ = ins;
+        succs_.resize(num_edges);
+        preds_.resize(num_edges);
+        for (vertex_t v = 0; v < size; ++v)
+          for (auto t : out(aut_, states_[v]))
+            {
+              auto w = index[aut_->dst_of(t)];
+              succs_[outs[v]++] = w;
+              preds_[ins[w]++] = v;
+            }
+      }
+
+      /// The successors (if \a forward) or predecessors of \a v.
+      boost::iterator_range<const vertex_t*>
+      adjacent_(vertex_t v, bool forward) const
+      {
+        const auto& offsets = forward ? succ_offsets_ : pred_offsets_;
+        const auto& adj = forward ? succs_ : preds_;
+        return {adj.data() + offsets[v], adj.data() + offsets[v + 1]};
+      }
+
+      /// Bits of mark_.
+      enum : unsigned char
+      {
+        trimmed_ = 1,
+        forward_ = 2,
+        backward_ = 4,
+      };
+
+      /// What splitting a subproblem produces.
+      struct split_t
+      {
+        /// Add \a v to the component being built.
+        void add_vertex(vertex_t v)
+        {
+          vertices.emplace_back(v);
+        }
+
+        /// Complete the component being built.
+        void close_component()
+        {
+          ends.emplace_back(vertices.size());
+        }
+
+        /// The vertices of the components found, contiguously.
+        vertices_t vertices;
+        /// The end of each component in vertices.
+        std::vector<size_t> ends;
+        /// The new subproblems.
+        std::vector<vertices_t> subproblems;
+      };
+
+      void solve_(unsigned num_threads)
+      {
+        const auto size = states_.size();
+        color_.assign(size, 0);
+        mark_.assign(size, 0);
+        in_degree_.resize(size);
+        out_degree_.resize(size);
+        auto problems = std::vector<vertices_t>{};
+        if (size)
+          {
+            problems.emplace_back(size);
+            std::iota(problems[0].begin(), problems[0].end(), 0);
+          }
+        auto splits = std::vector<split_t>{};
+        while (!problems.empty())
+          {
+            // Each subproblem reads the colors (which are not
+            // modified during the round), and writes only the marks
+            // and degrees of its own vertices.
+            splits.clear();
+            splits.resize(problems.size());
+            detail::parallel_for(problems.size(), num_threads,
+                                 [&](size_t i)
+                                 {
+                                   split_(i, problems[i], splits[i]);
+                                 });
+            problems.clear();
+            for (auto& sp: splits)
+              {
+                auto i = size_t{0};
+                for (auto e: sp.ends)
+                  {
+                    for (; i < e; ++i)
+                      {
+                        auto v = sp.vertices[i];
+                        components_.add_state(states_[v]);
+                        color_[v] = done_;
+                      }
+                    components_.close_component();
+                  }
+                for (auto& p: sp.subproblems)
+                  {
+                    for (auto v: p)
+                      color_[v] = problems.size();
+                    problems.emplace_back(std::move(p));
+                  }
+              }
+          }
+      }
+
+      /// Whether \a v is in the subproblem of color \a c, and not
+      /// trimmed.
+      bool inside_(vertex_t v, size_t c) const
+      {
+        return color_[v] == c && !(mark_[v] & trimmed_);
+      }
+
+      /// Split subproblem \a p, of color \a c, into \a res.
+      void split_(size_t c, const vertices_t& p, split_t& res)
+      {
+        // Small subproblems are solved at once.
+        if (p.size() <= small_)
+          return tarjan_(c, p, res);
+
+        // Trimming.
+        for (auto v: p)
+          mark_[v] = 0;
+        auto todo = vertices_t{};
+        for (auto v: p)
+          {
+            in_degree_[v] = out_degree_[v] = 0;
+            for (auto w: adjacent_(v, false))
+              in_degree_[v] += color_[w] == c;
+            for (auto w: adjacent_(v, true))
+              out_degree_[v] += color_[w] == c;
+            if (!in_degree_[v] || !out_degree_[v])
+              {
+                mark_[v] = trimmed_;
+                todo.emplace_back(v);
+              }
+          }
+        while (!todo.empty())
+          {
+            auto v = todo.back();
+            todo.pop_back();
+            res.add_vertex(v);
+            res.close_component();
+            for (auto w: adjacent_(v, true))
+              if (inside_(w, c) && !--in_degree_[w])
+                {
+                  mark_[w] = trimmed_;
+                  todo.emplace_back(w);
+                }
+            for (auto w: adjacent_(v, false))
+              if (inside_(w, c) && !--out_degree_[w])
+                {
+                  mark_[w] = trimmed_;
+                  todo.emplace_back(w);
+                }
+          }
+
+        auto rest = vertices_t{};
+        for (auto v: p)
+          if (!(mark_[v] & trimmed_))
+            rest.emplace_back(v);
+        if (rest.empty())
+          return;
+
+        // Forward and backward reachability from the pivot.  Pick it
+        // in the middle, to avoid quadratic behavior on chains of
+        // components.
+        auto pivot = rest[rest.size() / 2];
+        for (bool forward: {true, false})
+          {
+            const auto bit = forward ? forward_ : backward_;
+            mark_[pivot] |= bit;
+            todo.emplace_back(pivot);
+            while (!todo.empty())
+              {
+                auto v = todo.back();
+                todo.pop_back();
+                for (auto w: adjacent_(v, forward))
+                  if (inside_(w, c) && !(mark_[w] & bit))
+                    {
+                      mark_[w] |= bit;
+                      todo.emplace_back(w);
+                    }
+              }
+          }
+
+        // Dispatch the remaining vertices.
+        auto parts = std::vector<vertices_t>(4);
+        for (auto v: rest)
+          parts[(mark_[v] & (forward_ | backward_)) >> 1].emplace_back(v);
+        // On graphs with many small components, the pivot may leave
+        // most of the vertices in a single part, and forward-backward
+        // becomes quadratic.  Then, finish sequentially.
+        auto largest = std::max({parts[0].size(), parts[1].size(),
+                                 parts[2].size()});
+        if (rest.size() - rest.size() / 8 < largest)
+          return tarjan_(c, rest, res);
+        for (auto v: parts[3])
+          res.add_vertex(v);
+        res.close_component();
+        for (size_t i = 0; i < 3; ++i)
+          if (!parts[i].empty())
+            res.subproblems.emplace_back(std::move(parts[i]));
+      }
+
+      /// Solve subproblem \a p, of color \a c, with Tarjan's
+      /// algorithm.  Uses the degrees as number and low link.  The
+      /// trimmed vertices are ignored.
+      void tarjan_(size_t c, const vertices_t& p, split_t& res)
+      {
+        const auto unvisited = std::numeric_limits<unsigned>::max();
+        auto& number = in_degree_;
+        auto& low = out_degree_;
+        for (auto v: p)
+          {
+            mark_[v] = 0;
+            number[v] = unvisited;
+          }
+        auto count = 0u;
+        auto stack = vertices_t{};
+        // The vertex and the index of its next successor.
+        auto dfs = std::vector<std::pair<vertex_t, size_t>>{};
+        for (auto root: p)
+          if (number[root] == unvisited)
+            {
+              number[root] = low[root] = count++;
+              stack.emplace_back(root);
+              dfs.emplace_back(root, succ_offsets_[root]);
+              while (!dfs.empty())
+                {
+                  auto v = dfs.back().first;
+                  auto& i = dfs.back().second;
+                  if (i != succ_offsets_[v + 1])
+                    {
+                      auto w = succs_[i++];
+                      if (!inside_(w, c))
+                        continue;
+                      else if (number[w] == unvisited)
+                        {
+                          number[w] = low[w] = count++;
+                          stack.emplace_back(w);
+                          dfs.emplace_back(w, succ_offsets_[w]);
+                        }
+                      else if (low[w] < low[v])
+                        low[v] = low[w];
+                    }
+                  else
+                    {
+                      if (low[v] == number[v])
+                        {
+                          vertex_t w;
+                          do
+                            {
+                              w = stack.back();
+                              stack.pop_back();
+                              res.add_vertex(w);
+                              low[w] = unvisited;
+                            }
+                          while (w != v);
+                          res.close_component();
+                        }
+                      dfs.pop_back();
+                      if (!dfs.empty())
+                        {
+                          auto u = dfs.back().first;
+                          if (low[v] < low[u])
+                            low[u] = low[v];
+                        }
+                    }
+                }
+            }
+      }
+
+      /// Input automaton.
+      Aut aut_;
+      /// Vertex -> state.
+      std::vector<state_t> states_;
+      /// The successors of vertex v are
+      /// succs_[succ_offsets_[v], succ_offsets_[v+1]).
+      std::vector<size_t> succ_offsets_;
+      vertices_t succs_;
+      /// Likewise for the predecessors.
+      std::vector<size_t> pred_offsets_;
+      vertices_t preds_;
+      /// The size under which subproblems are solved sequentially.
+      static constexpr size_t small_ = 1024;
+      /// Vertex -> its subproblem in the current round, or done_.
+      std::vector<size_t> color_;
+      /// The color of the vertices whose component is known.
+      static constexpr size_t done_ = std::numeric_limits<size_t>::max();
+      /// Vertex -> marks, per subproblem.
+      std::vector<unsigned char> mark_;
+      /// Vertex -> number of predecessors and successors in its
+      /// subproblem, not trimmed (or number and low link in tarjan_).
+      std::vector<unsigned> in_degree_;
+      std::vector<unsigned> out_degree_;
+      /// All components.
+      scc_table<Aut> components_;
+    };
+
+    template <Automaton Aut>
+    constexpr size_t scc_impl<Aut, forward_backward_tag>::small_;
+    template <Automaton Aut>
+    constexpr size_t scc_impl<Aut, forward_backward_tag>::done_;
+  }
+
   /*--------.
   | auto.   |
   `--------*/
@@ -513,7 +1021,8 @@ namespace vcsn
     dijkstra,
     tarjan_iterative,
     tarjan_recursive,
-    kosaraju
+    kosaraju,
+    parallel
   };
 
   inline scc_algo_t scc_algo(const std::string& algo)
@@ -525,6 +1034,7 @@ namespace vcsn
           {"auto",             scc_algo_t::auto_},
           {"dijkstra",         scc_algo_t::dijkstra},
           {"kosaraju",         scc_algo_t::kosaraju},
+          {"parallel",         scc_algo_t::parallel},
           {"tarjan",           "tarjan,iterative"},
           {"tarjan,iterative", scc_algo_t::tarjan_iterative},
           {"tarjan,recursive", scc_algo_t::tarjan_recursive},
@@ -567,10 +1077,40 @@ namespace vcsn
         return strong_components(aut, tarjan_recursive_tag{});
       case scc_algo_t::tarjan_iterative:
         return strong_components(aut, tarjan_iterative_tag{});
+      case scc_algo_t::parallel:
+        return strong_components(aut, forward_backward_tag{});
       }
     BUILTIN_UNREACHABLE();
   }
 
+  /// Find all strongly connected components of \a aut, stored
+  /// contiguously.
+  ///
+  /// \param aut          the input automaton.
+  /// \param algo         specifies the chosen algorithm.
+  /// \param num_threads  for scc_algo_t::parallel, the number of
+  ///                     threads (0 for as many as supported by the
+  ///                     hardware).
+  template <Automaton Aut>
+  detail::scc_table<Aut>
+  strong_components_table(const Aut& aut,
+                          scc_algo_t algo = scc_algo_t::tarjan_iterative,
+                          unsigned num_threads = 0)
+  {
+    switch (algo)
+      {
+      case scc_algo_t::auto_:
+      case scc_algo_t::tarjan_iterative:
+        return detail::scc_impl<Aut, tarjan_iterative_tag>{aut}.table();
+      case scc_algo_t::parallel:
+        return detail::scc_impl<Aut, forward_backward_tag>{aut, num_threads}
+          .table();
+      default:
+        return detail::scc_table<Aut>
+          ::from_components(strong_components(aut, algo));
+      }
+  }
+
   /// Generate a subautomaton corresponding to an SCC.
   template <Automaton Aut>
   fresh_automaton_t_of<Aut>
@@ -624,13 +1164,17 @@ namespace vcsn
         // this, so that components are roughly numbered as the
         // condensation state numbers would be (0 as an initial
         // state).
-        const auto& cs = vcsn::strong_components(aut_, algo);
-        // FIXME: std::rbegin/rend does not work with libstdc++.
-        components_.assign(boost::rbegin(cs), boost::rend(cs));
-        size_t num_sccs = components_.size();
+        const auto& cs = vcsn::strong_components_table(aut_, algo);
+        size_t num_sccs = cs.size();
+        components_.reserve(num_sccs);
+        component_.resize(states_size(aut_));
         for (size_t i = 0; i < num_sccs; ++i)
-          for (auto s : components_[i])
-            component_[s] = i;
+          {
+            const auto& c = cs[num_sccs - 1 - i];
+            components_.emplace_back(c.begin(), c.end());
+            for (auto s : c)
+              component_[s] = i;
+          }
       }
 
       /// Static name.
@@ -683,7 +1227,7 @@ namespace vcsn
     private:
       using super_t::aut_;
       /// For each state, its component number.
-      std::map<state_t, size_t> component_;
+      std::vector<size_t> component_;
       components_t components_;
     };
   }
@@ -38,7 +38,9 @@ namespace vcsn
 
       /// Wordset.
       using labelset_t = labelset_t_of<polynomialset_t>;
-      using word_t = word_t_of<automaton_t>;
+      /// The words, as labels of the wordset (not necessarily the
+      /// words of the genset, e.g., interned_wordset).
+      using word_t = typename labelset_t::value_t;
 
       using weightset_t = weightset_t_of<automaton_t>;
       using weight_t = weight_t_of<automaton_t>;
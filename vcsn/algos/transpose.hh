@@ -1,5 +1,10 @@
 #pragma once
 
+#include <tuple>
+#include <vector>
+
+#include <boost/range/size.hpp>
+
 #include <vcsn/algos/copy.hh>
 #include <vcsn/algos/fwd.hh>
 #include <vcsn/algos/strip.hh>
@@ -152,12 +157,16 @@ namespace vcsn
       | non-const methods that transpose.  |
       `-----------------------------------*/
 
-#define DEFINE(Signature, Value)                \
-      auto                                      \
-      Signature                                 \
-        -> decltype(aut_->Value)                \
-      {                                         \
-        return aut_->Value;                     \
+      // Make the return type depend on a template parameter, so that
+      // transposing an automaton that does not support these (e.g., a
+      // frozen automaton) is valid, as long as they are not used.
+#define DEFINE(Signature, Value)                        \
+      template <typename Aut_ = automaton_t>            \
+      auto                                              \
+      Signature                                         \
+        -> decltype(std::declval<Aut_>()->Value)        \
+      {                                                 \
+        return aut_->Value;                             \
       }
 
       DEFINE(set_lazy(state_t s, bool l = true),     set_lazy_in(s, l));
@@ -209,22 +218,44 @@ namespace vcsn
       DEFINE(add_final(state_t s, weight_t k),
              add_initial(s, aut_->weightset()->transpose(k)));
 
-      template <Automaton A>
-      DEFINE(add_transition_copy(state_t src, state_t dst,
-                                 const A& aut,
-                                 transition_t_of<A> t,
-                                 bool transpose = false),
-             add_transition_copy(dst, src, aut, t, !transpose));
+#undef DEFINE
+
+#define DEFINE(Name)                                                    \
+      template <Automaton A>                                            \
+      auto                                                              \
+      Name(state_t src, state_t dst,                                    \
+           const A& aut, transition_t_of<A> t,                          \
+           bool transpose = false)                                      \
+        -> decltype(std::declval<dependent_t<automaton_t, A>>()         \
+                    ->Name(dst, src, aut, t, !transpose))               \
+      {                                                                 \
+        return aut_->Name(dst, src, aut, t, !transpose);                \
+      }
 
-      template <Automaton A>
-      DEFINE(new_transition_copy(state_t src, state_t dst,
-                                 const A& aut,
-                                 transition_t_of<A> t,
-                                 bool transpose = false),
-             new_transition_copy(dst, src, aut, t, !transpose));
+      DEFINE(add_transition_copy);
+      DEFINE(new_transition_copy);
 
 #undef DEFINE
 
+      /// Create the transitions \a ts, a range of (src, dst, label,
+      /// weight) tuples, without looking for existing ones.
+      template <typename Transitions, typename Aut_ = automaton_t>
+      auto
+      new_transitions_unchecked(const Transitions& ts)
+        -> decltype(std::declval<Aut_>()->new_transitions_unchecked(ts))
+      {
+        const auto& ls = *aut_->labelset();
+        const auto& ws = *aut_->weightset();
+        auto rts
+          = std::vector<std::tuple<state_t, state_t, label_t, weight_t>>{};
+        rts.reserve(boost::size(ts));
+        for (const auto& t: ts)
+          rts.emplace_back(std::get<1>(t), std::get<0>(t),
+                           ls.transpose(std::get<2>(t)),
+                           ws.transpose(std::get<3>(t)));
+        return aut_->new_transitions_unchecked(rts);
+      }
+
 
 
       /*-----------------------------------.
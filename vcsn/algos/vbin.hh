@@ -0,0 +1,429 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring> // memcpy
+#include <iostream>
+#include <iterator> // istreambuf_iterator
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <vcsn/core/automaton.hh> // all_out, states_size
+#include <vcsn/core/mutable-automaton.hh>
+#include <vcsn/dyn/automaton.hh>
+#include <vcsn/dyn/context.hh>
+#include <vcsn/misc/functional.hh> // vcsn::hash
+#include <vcsn/misc/mapped-file.hh>
+#include <vcsn/misc/raise.hh>
+#include <vcsn/misc/stream.hh> // conv
+#include <vcsn/misc/to-string.hh>
+
+namespace vcsn
+{
+  /*--------------------------.
+  | vbin(automaton, stream).  |
+  `--------------------------*/
+
+  // The vbin format is a dump of the automaton, designed to be
+  // loaded with as little work as possible.  All the integers are in
+  // native byte order, and the sections are aligned on 8 bytes.
+  //
+  //   "VCSNBIN\n"
+  //   u32 version, u32 byte-order mark
+  //   u64 n, n bytes: the context, as in daut
+  //   u64 number of states, including pre (0) and post (1)
+  //   u64 number of transitions, including initial and final ones
+  //   u64 n, n strings (u64 length, bytes): the labels
+  //   u64 n, n strings (u64 length, bytes): the weights
+  //   u64 offsets[states + 1]: the outgoing transitions of state s
+  //                            are [offsets[s], offsets[s+1])
+  //   u32 dst[transitions]
+  //   u32 label[transitions]: an index in the labels, or -1 for
+  //                           the special label (initial and final
+  //                           transitions)
+  //   u32 weight[transitions]: an index in the weights
+  //
+  // Labels and weights are stored once, as text, so any context can
+  // be saved.  The states are numbered densely, in order.
+
+  namespace detail
+  {
+    /// The magic string of vbin files.
+    inline const char* vbin_magic()
+    {
+      return "VCSNBIN\n";
+    }
+
+    /// The current version of the format.
+    constexpr std::uint32_t vbin_version = 1;
+
+    /// Allows to detect files saved on an architecture with a
+    /// different byte order.
+    constexpr std::uint32_t vbin_byte_order = 0x01020304;
+
+    /// The index of the special label.
+    constexpr std::uint32_t vbin_special = -1;
+
+    /// Read the header of a vbin file, and return its context.
+    inline std::string vbin_read_header(std::istream& is)
+    {
+      char magic[8];
+      std::uint32_t version = 0;
+      std::uint32_t order = 0;
+      std::uint64_t size = 0;
+      is.read(magic, sizeof magic);
+      is.read(reinterpret_cast<char*>(&version), sizeof version);
+      is.read(reinterpret_cast<char*>(&order), sizeof order);
+      is.read(reinterpret_cast<char*>(&size), sizeof size);
+      require(is.good() && !std::memcmp(magic, vbin_magic(), sizeof magic),
+              "vbin: invalid header");
+      require(version == vbin_version,
+              "vbin: unsupported version: ", version);
+      require(order == vbin_byte_order,
+              "vbin: unsupported byte order");
+      auto res = std::string(size, '\0');
+      is.read(&res[0], size);
+      // Skip the padding.
+      is.ignore((8 - size % 8) % 8);
+      require(is.good(), "vbin: truncated context");
+      return res;
+    }
+
+    /// Save an automaton in vbin.
+    template <Automaton Aut>
+    class vbin_writer
+    {
+    public:
+      using automaton_t = Aut;
+      using context_t = context_t_of<automaton_t>;
+      using labelset_t = labelset_t_of<automaton_t>;
+      using label_t = label_t_of<automaton_t>;
+      using weightset_t = weightset_t_of<automaton_t>;
+      using weight_t = weight_t_of<automaton_t>;
+      using state_t = state_t_of<automaton_t>;
+
+      vbin_writer(const automaton_t& aut, std::ostream& os)
+        : aut_(aut)
+        , os_(os)
+      {}
+
+      std::ostream& operator()()
+      {
+        os_.write(vbin_magic(), 8);
+        size_ += 8;
+        put_u32_(vbin_version);
+        put_u32_(vbin_byte_order);
+        {
+          auto ctx = std::ostringstream{};
+          aut_->context().print_set(ctx, format::sname);
+          put_string_(ctx.str());
+        }
+        align_();
+
+        // Number the states: pre, post, and then the others.
+        auto states = std::vector<state_t>{aut_->pre(), aut_->post()};
+        for (auto s: aut_->states())
+          states.emplace_back(s);
+        auto index = std::vector<std::uint32_t>(states_size(aut_));
+        for (size_t i = 0; i < states.size(); ++i)
+          index[states[i]] = i;
+
+        // Gather the transitions, and number the labels and weights.
+        const auto& ls = *aut_->labelset();
+        const auto& ws = *aut_->weightset();
+        auto labels = std::unordered_map<label_t, std::uint32_t,
+                                         vcsn::hash<labelset_t>,
+                                         vcsn::equal_to<labelset_t>>{};
+        auto weights = std::unordered_map<weight_t, std::uint32_t,
+                                          vcsn::hash<weightset_t>,
+                                          vcsn::equal_to<weightset_t>>{};
+        auto label_strings = std::vector<std::string>{};
+        auto weight_strings = std::vector<std::string>{};
+        auto offsets = std::vector<std::uint64_t>{0};
+        auto dsts = std::vector<std::uint32_t>{};
+        auto lbls = std::vector<std::uint32_t>{};
+        auto wgts = std::vector<std::uint32_t>{};
+        offsets.reserve(states.size() + 1);
+        for (auto s: states)
+          {
+            for (auto t: all_out(aut_, s))
+              {
+                dsts.emplace_back(index[aut_->dst_of(t)]);
+                const auto& l = aut_->label_of(t);
+                if (ls.is_special(l))
+                  lbls.emplace_back(vbin_special);
+                else
+                  {
+                    auto i = labels.emplace(l, labels.size());
+                    if (i.second)
+                      label_strings.emplace_back(to_string(ls, l, format{}));
+                    lbls.emplace_back(i.first->second);
+                  }
+                const auto& w = aut_->weight_of(t);
+                auto i = weights.emplace(w, weights.size());
+                if (i.second)
+                  weight_strings.emplace_back(to_string(ws, w, format{}));
+                wgts.emplace_back(i.first->second);
+              }
+            offsets.emplace_back(dsts.size());
+          }
+
+        put_u64_(states.size());
+        put_u64_(dsts.size());
+        put_strings_(label_strings);
+        put_strings_(weight_strings);
+        put_array_(offsets);
+        put_array_(dsts);
+        put_array_(lbls);
+        put_array_(wgts);
+        return os_;
+      }
+
+    private:
+      void put_u32_(std::uint32_t v)
+      {
+        os_.write(reinterpret_cast<const char*>(&v), sizeof v);
+        size_ += sizeof v;
+      }
+
+      void put_u64_(std::uint64_t v)
+      {
+        os_.write(reinterpret_cast<const char*>(&v), sizeof v);
+        size_ += sizeof v;
+      }
+
+      void put_string_(const std::string& s)
+      {
+        put_u64_(s.size());
+        os_.write(s.data(), s.size());
+        size_ += s.size();
+      }
+
+      void put_strings_(const std::vector<std::string>& ss)
+      {
+        put_u64_(ss.size());
+        for (const auto& s: ss)
+          put_string_(s);
+        align_();
+      }
+
+      template <typename T>
+      void put_array_(const std::vector<T>& v)
+      {
+        os_.write(reinterpret_cast<const char*>(v.data()),
+                  v.size() * sizeof(T));
+        size_ += v.size() * sizeof(T);
+        align_();
+      }
+
+      /// Pad with zeroes to the next multiple of 8.
+      void align_()
+      {
+        for (; size_ % 8; ++size_)
+          os_.put('\0');
+      }
+
+      /// The automaton to save.
+      const automaton_t& aut_;
+      /// Output stream.
+      std::ostream& os_;
+      /// Number of bytes written.
+      std::uint64_t size_ = 0;
+    };
+
+    /// Load the body of a vbin file, i.e., all but the header.
+    template <typename Context>
+    class vbin_reader
+    {
+    public:
+      using context_t = Context;
+      using automaton_t = mutable_automaton<context_t>;
+      using label_t = label_t_of<context_t>;
+      using weight_t = weight_t_of<context_t>;
+      using state_t = state_t_of<automaton_t>;
+
+      vbin_reader(const context_t& ctx, std::istream& is)
+        : ctx_(ctx)
+        , is_(is)
+      {}
+
+      automaton_t operator()()
+      {
+        // Access the contents directly if they are in memory (e.g.,
+        // a mapped file), otherwise load them.
+        auto buf = dynamic_cast<memory_streambuf*>(is_.rdbuf());
+        auto contents = std::string{};
+        if (buf)
+          {
+            begin_ = cur_ = buf->current();
+            end_ = buf->end();
+          }
+        else
+          {
+            contents.assign(std::istreambuf_iterator<char>(is_), {});
+            begin_ = cur_ = contents.data();
+            end_ = begin_ + contents.size();
+          }
+
+        const auto& ls = *ctx_.labelset();
+        const auto& ws = *ctx_.weightset();
+        auto res = make_mutable_automaton(ctx_);
+
+        auto num_states = get_u64_();
+        auto num_transitions = get_u64_();
+        require(2 <= num_states, "vbin: invalid number of states");
+        auto labels = std::vector<label_t>{};
+        for (auto n = get_u64_(); n; --n)
+          labels.emplace_back(conv(ls, get_string_()));
+        align_();
+        auto weights = std::vector<weight_t>{};
+        for (auto n = get_u64_(); n; --n)
+          weights.emplace_back(conv(ws, get_string_()));
+        align_();
+        auto offsets = get_array_<std::uint64_t>(num_states + 1);
+        auto dsts = get_array_<std::uint32_t>(num_transitions);
+        auto lbls = get_array_<std::uint32_t>(num_transitions);
+        auto wgts = get_array_<std::uint32_t>(num_transitions);
+
+        auto states = std::vector<state_t>{res->pre(), res->post()};
+        states.reserve(num_states);
+        while (states.size() < num_states)
+          states.emplace_back(res->new_state());
+
+        // The file was saved from an automaton, so there are no
+        // duplicate transitions: no need to look for them.
+        require(load_<std::uint64_t>(offsets, 0) == 0
+                && load_<std::uint64_t>(offsets, num_states) == num_transitions,
+                "vbin: invalid offsets");
+        for (size_t s = 0; s < num_states; ++s)
+          {
+            auto e = load_<std::uint64_t>(offsets, s + 1);
+            require(load_<std::uint64_t>(offsets, s) <= e, "vbin: invalid offsets");
+            for (auto t = load_<std::uint64_t>(offsets, s); t < e; ++t)
+              {
+                auto d = load_(dsts, t);
+                auto l = load_(lbls, t);
+                auto w = load_(wgts, t);
+                require(d < num_states, "vbin: invalid state: ", d);
+                require(l == vbin_special || l < labels.size(),
+                        "vbin: invalid label: ", l);
+                require(w < weights.size(), "vbin: invalid weight: ", w);
+                res->new_transition(states[s], states[d],
+                                    l == vbin_special ? ls.special() : labels[l],
+                                    weights[w]);
+              }
+          }
+
+        if (buf)
+          buf->seek(cur_);
+        else
+          require(cur_ == end_, "vbin: unexpected trailing characters");
+        return res;
+      }
+
+    private:
+      /// Make sure there are at least \a n more bytes.
+      void need_(std::uint64_t n) const
+      {
+        require(n <= std::uint64_t(end_ - cur_), "vbin: truncated file");
+      }
+
+      std::uint64_t get_u64_()
+      {
+        need_(sizeof(std::uint64_t));
+        auto res = load_<std::uint64_t>(cur_, 0);
+        cur_ += sizeof res;
+        return res;
+      }
+
+      std::string get_string_()
+      {
+        auto n = get_u64_();
+        need_(n);
+        auto res = std::string(cur_, n);
+        cur_ += n;
+        return res;
+      }
+
+      /// Skip the padding up to the next multiple of 8.
+      void align_()
+      {
+        auto n = (8 - (cur_ - begin_) % 8) % 8;
+        need_(n);
+        cur_ += n;
+      }
+
+      /// The beginning of an array of \a n values of type \a T.
+      template <typename T>
+      const char* get_array_(std::uint64_t n)
+      {
+        require(n <= std::uint64_t(end_ - cur_) / sizeof(T),
+                "vbin: truncated file");
+        auto res = cur_;
+        cur_ += n * sizeof(T);
+        align_();
+        return res;
+      }
+
+      /// The \a i-th value of type \a T in \a array.
+      ///
+      /// The arrays are not necessarily aligned in memory.
+      template <typename T = std::uint32_t>
+      static T load_(const char* array, std::uint64_t i)
+      {
+        T res;
+        std::memcpy(&res, array + i * sizeof(T), sizeof(T));
+        return res;
+      }
+
+      /// The context of the automaton.
+      const context_t& ctx_;
+      /// Input stream.
+      std::istream& is_;
+      /// The contents.
+      const char* begin_ = nullptr;
+      const char* cur_ = nullptr;
+      const char* end_ = nullptr;
+    };
+  }
+
+  /// Save \a aut in vbin format.
+  ///
+  /// \param aut  the automaton to save.
+  /// \param out  the output stream, opened in binary mode.
+  template <Automaton Aut>
+  std::ostream&
+  vbin(const Aut& aut, std::ostream& out = std::cout)
+  {
+    auto vbin = detail::vbin_writer<Aut>{aut, out};
+    return vbin();
+  }
+
+  /// Load an automaton in vbin format, except its header.
+  ///
+  /// If the stream is on a memory_streambuf (e.g., a mapped file),
+  /// the data is not copied.
+  template <typename Context>
+  mutable_automaton<Context>
+  read_vbin(const Context& ctx, std::istream& is)
+  {
+    auto read = detail::vbin_reader<Context>{ctx, is};
+    return read();
+  }
+
+  namespace dyn
+  {
+    namespace detail
+    {
+      /// Bridge.
+      template <typename Context, typename Istream>
+      automaton
+      read_vbin(const context& ctx, std::istream& is)
+      {
+        const auto& c = ctx->as<Context>();
+        return ::vcsn::read_vbin(c, is);
+      }
+    }
+  }
+}
@@ -3,6 +3,7 @@
 #include <vcsn/concepts/automaton.hh> // Automaton.
 #include <vcsn/ctx/traits.hh>
 #include <vcsn/misc/memory.hh>
+#include <vcsn/misc/type_traits.hh> // dependent_t
 
 namespace vcsn
 {
@@ -161,13 +162,17 @@ namespace vcsn
       | non const.  |
       `------------*/
 
-#define DEFINE(Name)                                            \
-      template <typename... Args>                               \
-      auto                                                      \
-      Name(Args&&... args)                                      \
-        -> decltype(aut_->Name(std::forward<Args>(args)...))    \
-      {                                                         \
-        return aut_->Name(std::forward<Args>(args)...);         \
+      // Make the return type depend on Args, so that decorating an
+      // automaton that does not support these (e.g., a frozen
+      // automaton) is valid, as long as they are not used.
+#define DEFINE(Name)                                                    \
+      template <typename... Args>                                       \
+      auto                                                              \
+      Name(Args&&... args)                                              \
+        -> decltype(std::declval<dependent_t<automaton_t, Args...>>()   \
+                    ->Name(std::forward<Args>(args)...))                \
+      {                                                                 \
+        return aut_->Name(std::forward<Args>(args)...);                 \
       }
 
       DEFINE(add_final);
@@ -177,10 +182,14 @@ namespace vcsn
       DEFINE(add_weight);
       DEFINE(del_state);
       DEFINE(del_transition);
+      DEFINE(finalize);
       DEFINE(lweight);
       DEFINE(new_state);
       DEFINE(new_transition);
       DEFINE(new_transition_copy);
+      DEFINE(new_transitions_unchecked);
+      DEFINE(reserve_states);
+      DEFINE(reserve_transitions);
       DEFINE(rweight);
       DEFINE(set_final);
       DEFINE(set_lazy);
@@ -192,6 +201,21 @@ namespace vcsn
       DEFINE(unset_initial);
 
 #undef DEFINE
+
+    protected:
+      /// The memoized properties of the decorated automaton.
+      ///
+      /// Not public, since some decorators (e.g., transpose, filter)
+      /// do not have the properties of the automaton they decorate.
+      /// Those that expose it as is publish it with `using
+      /// super_t::properties;`.
+      template <typename A = automaton_t>
+      auto
+      properties() const
+        -> decltype(std::declval<A>()->properties())
+      {
+        return aut_->properties();
+      }
     };
   }
 }
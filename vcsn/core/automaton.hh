@@ -92,11 +92,23 @@ namespace vcsn
                      });
     }
 
-    /// Indexes of all transitions leaving state \a s on label \a l.
-    ///
-    /// Invalidated by del_transition() and del_state().
+    // Rely on the fact that int takes precedence over long to express
+    // a precedence of this first function over the second one.
+
+    // Automata that feature an out(s, l) member function, such as
+    // frozen automata, which can answer without a linear scan.
     template <Automaton Aut>
-    auto out(const Aut& aut, state_t_of<Aut> s, label_t_of<Aut> l)
+    auto out_by_label_(const Aut& aut, state_t_of<Aut> s, label_t_of<Aut> l,
+                       int)
+      -> decltype(aut->out(s, l))
+    {
+      return aut->out(s, l);
+    }
+
+    // Automata that don't: filter the outgoing transitions.
+    template <Automaton Aut>
+    auto out_by_label_(const Aut& aut, state_t_of<Aut> s, label_t_of<Aut> l,
+                       long)
     {
       return all_out(aut, s,
                      [&aut,l](transition_t_of<Aut> t)
@@ -105,6 +117,15 @@ namespace vcsn
                      });
     }
 
+    /// Indexes of all transitions leaving state \a s on label \a l.
+    ///
+    /// Invalidated by del_transition() and del_state().
+    template <Automaton Aut>
+    auto out(const Aut& aut, state_t_of<Aut> s, label_t_of<Aut> l)
+    {
+      return out_by_label_(aut, s, l, 0);
+    }
+
     /*------------------------.
     | Incoming transitions.   |
     `------------------------*/
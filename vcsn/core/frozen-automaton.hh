@@ -0,0 +1,527 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <numeric> // partial_sum
+#include <vector>
+
+#include <boost/range/irange.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <vcsn/concepts/automaton.hh>
+#include <vcsn/core/automaton.hh> // states_size
+#include <vcsn/core/fwd.hh>
+#include <vcsn/core/mutable-automaton.hh> // fresh_automaton_t
+#include <vcsn/core/property-cache.hh>
+#include <vcsn/ctx/context.hh>
+#include <vcsn/ctx/traits.hh>
+#include <vcsn/misc/algorithm.hh> // none_of
+#include <vcsn/misc/crange.hh>
+#include <vcsn/misc/format.hh>
+#include <vcsn/misc/raise.hh>
+#include <vcsn/misc/symbol.hh>
+
+namespace vcsn
+{
+  namespace detail
+  {
+  /// Read-only automata, in compressed sparse row (CSR) format.
+  ///
+  /// The transitions are stored in a handful of contiguous arrays
+  /// (sources, destinations, labels and weights), grouped by source
+  /// state, and sorted by label, then by destination, within each
+  /// group.  A transition is designated by its rank in these arrays,
+  /// so the outgoing transitions of a state are a simple interval,
+  /// delimited by `out_offsets_`.  The incoming transitions are
+  /// indexed separately (`in_`, delimited by `in_offsets_`).
+  ///
+  /// States are renumbered densely: pre() and post() are 0 and 1,
+  /// the other states of the input automaton follow, in order.
+  ///
+  /// Because labels are sorted, `out(s, l)` is a binary search.
+  template <typename Context>
+  class frozen_automaton_impl
+  {
+  public:
+    using context_t = Context;
+    using self_t = frozen_automaton_impl;
+    /// The (shared pointer) type to use if we have to create an
+    /// automaton of the same (underlying) type.
+    template <typename Ctx = Context>
+    using fresh_automaton_t = mutable_automaton<Ctx>;
+    using labelset_t = labelset_t_of<context_t>;
+    using weightset_t = weightset_t_of<context_t>;
+    using kind_t = typename context_t::kind_t;
+
+    using labelset_ptr = typename context_t::labelset_ptr;
+    using weightset_ptr = typename context_t::weightset_ptr;
+
+    /// Lightweight state handle (or index).
+    ///
+    /// Same as for mutable automata, as algorithms typically mix the
+    /// states of their input with those of their (fresh) output.
+    using state_t = state_t_of<mutable_automaton<context_t>>;
+    /// Lightweight transition handle (or index).
+    using transition_t = transition_t_of<mutable_automaton<context_t>>;
+    /// Transition label.
+    using label_t = typename labelset_t::value_t;
+    /// Transition weight.
+    using weight_t = typename weightset_t::value_t;
+
+  protected:
+    /// The algebraic type of this automaton.
+    context_t ctx_;
+
+    /// For each state s, its outgoing transitions are
+    /// [out_offsets_[s], out_offsets_[s + 1]).
+    std::vector<transition_t> out_offsets_;
+    /// For each state s, its incoming transitions are
+    /// in_[in_offsets_[s] .. in_offsets_[s + 1]).
+    std::vector<unsigned> in_offsets_;
+    /// Incoming transitions, grouped by destination state.
+    std::vector<transition_t> in_;
+
+    /// Transition-indexed source states.
+    std::vector<state_t> srcs_;
+    /// Transition-indexed destination states.
+    std::vector<state_t> dsts_;
+    /// Transition-indexed labels.
+    std::vector<label_t> labels_;
+    /// Transition-indexed weights.
+    std::vector<weight_t> weights_;
+
+    /// Label for initial and final transitions.
+    label_t prepost_label_;
+    /// Memoized properties.  Never invalidated.
+    mutable property_cache properties_;
+
+  public:
+    frozen_automaton_impl() = delete;
+    frozen_automaton_impl(const frozen_automaton_impl&) = delete;
+    frozen_automaton_impl(frozen_automaton_impl&&) = default;
+
+    /// Freeze \a aut.
+    ///
+    /// \throws std::runtime_error if some states of \a aut are lazy.
+    template <Automaton Aut>
+    frozen_automaton_impl(const Aut& aut)
+      : ctx_{aut->context()}
+      , prepost_label_(ctx_.labelset()->special())
+    {
+      require(none_of(aut->all_states(),
+                      [&aut](state_t_of<Aut> s)
+                      {
+                        return aut->is_lazy(s) || aut->is_lazy_in(s);
+                      }),
+              "freeze: lazy automaton");
+
+      // Input state -> frozen state.
+      auto map = std::vector<state_t>(states_size(aut), null_state());
+      auto num = 2u;
+      for (auto s: aut->all_states())
+        map[s]
+          = s == aut->pre() ? pre()
+          : s == aut->post() ? post()
+          : state_t(num++);
+
+      // Input states, in frozen order.
+      auto order = std::vector<state_t_of<Aut>>(num, aut->null_state());
+      for (auto s: aut->all_states())
+        order[map[s]] = s;
+
+      const auto& ls = *labelset();
+      auto less = [&aut, &ls, &map](transition_t_of<Aut> l,
+                                    transition_t_of<Aut> r)
+        {
+          const auto& ll = aut->label_of(l);
+          const auto& rl = aut->label_of(r);
+          if (ls.less(ll, rl))
+            return true;
+          else if (ls.less(rl, ll))
+            return false;
+          else
+            return map[aut->dst_of(l)] < map[aut->dst_of(r)];
+        };
+
+      // The outgoing transitions, sorted, state by state.
+      out_offsets_.reserve(num + 1);
+      out_offsets_.emplace_back(0u);
+      auto ts = std::vector<transition_t_of<Aut>>{};
+      for (auto s: order)
+        {
+          ts.assign(aut->all_out(s).begin(), aut->all_out(s).end());
+          std::sort(ts.begin(), ts.end(), less);
+          for (auto t: ts)
+            {
+              srcs_.emplace_back(map[s]);
+              dsts_.emplace_back(map[aut->dst_of(t)]);
+              labels_.emplace_back(aut->label_of(t));
+              weights_.emplace_back(aut->weight_of(t));
+            }
+          out_offsets_.emplace_back(srcs_.size());
+        }
+
+      // The incoming transitions: a counting sort on the destination.
+      // Since we scan the transitions in order, the incoming
+      // transitions of a state are sorted by source.
+      in_offsets_.assign(num + 1, 0);
+      for (auto d: dsts_)
+        ++in_offsets_[d + 1];
+      std::partial_sum(in_offsets_.begin(), in_offsets_.end(),
+                       in_offsets_.begin());
+      in_.resize(dsts_.size());
+      auto next = std::vector<unsigned>(in_offsets_.begin(),
+                                        in_offsets_.end() - 1);
+      for (auto t = 0u; t < dsts_.size(); ++t)
+        in_[next[dsts_[t]]++] = t;
+    }
+
+
+    /*----------------.
+    | Related sets.   |
+    `----------------*/
+
+    static symbol sname()
+    {
+      static auto res
+        = symbol{"frozen_automaton<" + context_t::sname() + '>'};
+      return res;
+    }
+
+    std::ostream& print_set(std::ostream& o = std::cout, format fmt = {}) const
+    {
+      o << "frozen_automaton<";
+      context().print_set(o, fmt);
+      return o << '>';
+    }
+
+    const context_t& context() const { return ctx_; }
+    const weightset_ptr& weightset() const { return ctx_.weightset(); }
+    const labelset_ptr& labelset() const { return ctx_.labelset(); }
+
+
+    /// The memoized properties of this automaton.
+    property_cache& properties() const
+    {
+      return properties_;
+    }
+
+
+    /*----------------------------------.
+    | Special states and transitions.   |
+    `----------------------------------*/
+
+    static constexpr state_t      pre()  { return 0U; }
+    static constexpr state_t      post()  { return 1U; }
+    /// Invalid  state.
+    static constexpr state_t      null_state()      { return -1U; }
+    /// Invalid transition.
+    static constexpr transition_t null_transition() { return -1U; }
+    /// Invalid transition that shows that the state's outgoing
+    /// transitions are unknown.  Never used here.
+    static constexpr transition_t lazy_transition() { return -2U; }
+
+    /// Label for preinitial and postfinal transitions.
+    label_t prepost_label() const
+    {
+      return prepost_label_;
+    }
+
+
+    /*--------------.
+    | Statistics.   |
+    `--------------*/
+
+    size_t num_all_states() const { return out_offsets_.size() - 1; }
+    size_t num_states() const { return num_all_states() - 2; }
+    size_t num_initials() const { return all_out(pre()).size(); }
+    size_t num_finals() const { return all_in(post()).size(); }
+    size_t num_transitions() const
+    {
+      return srcs_.size() - num_initials() - num_finals();
+    }
+
+
+    /*---------------------.
+    | Queries on states.   |
+    `---------------------*/
+
+    /// Whether state s belongs to the automaton.
+    bool
+    has_state(state_t s) const
+    {
+      return s < num_all_states();
+    }
+
+    /// Frozen automata are never lazy.
+    static constexpr bool
+    is_lazy(state_t)
+    {
+      return false;
+    }
+
+    /// Frozen automata are never lazy.
+    static constexpr bool
+    is_lazy_in(state_t)
+    {
+      return false;
+    }
+
+    /// Whether s is initial.
+    bool
+    is_initial(state_t s) const
+    {
+      return has_transition(pre(), s, prepost_label_);
+    }
+
+    /// Whether s is final.
+    bool
+    is_final(state_t s) const
+    {
+      return has_transition(s, post(), prepost_label_);
+    }
+
+    /// Initial weight of s.
+    ATTRIBUTE_PURE
+    weight_t
+    get_initial_weight(state_t s) const
+    {
+      transition_t t = get_transition(pre(), s, prepost_label_);
+      if (t == null_transition())
+        return weightset()->zero();
+      else
+        return weight_of(t);
+    }
+
+    /// Final weight of s.
+    ATTRIBUTE_PURE
+    weight_t
+    get_final_weight(state_t s) const
+    {
+      transition_t t = get_transition(s, post(), prepost_label_);
+      if (t == null_transition())
+        return weightset()->zero();
+      else
+        return weight_of(t);
+    }
+
+
+    /*--------------------------.
+    | Queries on transitions.   |
+    `--------------------------*/
+
+    /// The transition (src, l, dst), or null_transition().
+    ///
+    /// A binary search in the outgoing transitions of \a src.
+    transition_t
+    get_transition(state_t src, state_t dst, label_t l) const
+    {
+      assert(has_state(src));
+      assert(has_state(dst));
+      const auto& ls = *labelset();
+      auto t = partition_point_(out_offsets_[src], out_offsets_[src + 1],
+                                [this, &ls, &l, dst](transition_t t)
+                                {
+                                  return (ls.less(label_of(t), l)
+                                          || (ls.equal(label_of(t), l)
+                                              && dst_of(t) < dst));
+                                });
+      if (t < out_offsets_[src + 1]
+          && dst_of(t) == dst
+          && ls.equal(label_of(t), l))
+        return t;
+      else
+        return null_transition();
+    }
+
+    bool
+    has_transition(state_t src, state_t dst, label_t l) const
+    {
+      return get_transition(src, dst, l) != null_transition();
+    }
+
+    bool
+    has_transition(transition_t t) const
+    {
+      // Any number outside our container is not a transition.
+      // (This includes "null_transition()".)
+      return t < srcs_.size();
+    }
+
+    state_t src_of(transition_t t) const   { return srcs_[t]; }
+    state_t dst_of(transition_t t) const   { return dsts_[t]; }
+    label_t label_of(transition_t t) const { return labels_[t]; }
+    weight_t weight_of(transition_t t) const { return weights_[t]; }
+
+
+    /*-----------.
+    | Printing.  |
+    `-----------*/
+
+    std::ostream&
+    print_state(state_t s, std::ostream& o = std::cout) const
+    {
+      if (s == pre())
+        o << "pre";
+      else if (s == post())
+        o << "post";
+      else
+        o << s - 2;
+      return o;
+    }
+
+    std::ostream&
+    print_state_name(state_t s, std::ostream& o = std::cout,
+                     format = {},
+                     bool = false) const
+    {
+      return print_state(s, o);
+    }
+
+    static constexpr bool
+    state_has_name(state_t)
+    {
+      return false;
+    }
+
+    /// Print a transition, for debugging.
+    std::ostream& print(transition_t t, std::ostream& o = std::cout,
+                        format fmt = {}) const
+    {
+      if (t == null_transition())
+        o << "null_transition";
+      else
+        {
+          o << t << ": ";
+          print_state_name(src_of(t), o) << " -- <";
+          weightset()->print(weight_of(t), o, fmt.for_weights()) << '>';
+          labelset()->print(label_of(t), o, fmt.for_labels()) << " --> ";
+          print_state_name(dst_of(t), o);
+        }
+      return o;
+    }
+
+    /// Print an automaton, for debugging.
+    std::ostream& print(std::ostream& o = std::cout) const
+    {
+      for (auto s: all_states())
+        {
+          o << "State: ";
+          print_state_name(s, o) << '\n';
+          o << "  Incoming:\n";
+          for (auto t: all_in(s))
+            {
+              o << "    ";
+              print(t, o) << '\n';
+            }
+          o << "  Outgoing:\n";
+          for (auto t: all_out(s))
+            {
+              o << "    ";
+              print(t, o) << '\n';
+            }
+        }
+      return o;
+    }
+
+
+    /*---------------------------------------.
+    | Iteration on states and transitions.   |
+    `---------------------------------------*/
+
+    /// All states including pre()/post().
+    /// Guaranteed in increasing order.
+    auto all_states() const
+    {
+      return boost::irange<state_t>(0U, num_all_states());
+    }
+
+    /// All states including pre()/post() that validate \a pred.
+    /// Guaranteed in increasing order.
+    template <typename Pred>
+    auto all_states(Pred pred) const
+    {
+      return make_container_filter_range(all_states(), pred);
+    }
+
+    /// All states excluding pre()/post().
+    /// Guaranteed in increasing order.
+    auto states() const
+    {
+      return boost::irange<state_t>(post() + 1, num_all_states());
+    }
+
+    /// All the transition indexes between all states (including pre and post).
+    auto all_transitions() const
+    {
+      return boost::irange<transition_t>(0U, srcs_.size());
+    }
+
+    /// Indexes of all transitions leaving state \a s, sorted by label.
+    auto all_out(state_t s) const
+    {
+      assert(has_state(s));
+      return boost::irange<transition_t>(out_offsets_[s],
+                                         out_offsets_[s + 1]);
+    }
+
+    /// Indexes of all transitions leaving state \a s on label \a l.
+    auto out(state_t s, const label_t& l) const
+    {
+      assert(has_state(s));
+      const auto& ls = *labelset();
+      auto b = partition_point_(out_offsets_[s], out_offsets_[s + 1],
+                                [this, &ls, &l](transition_t t)
+                                {
+                                  return ls.less(label_of(t), l);
+                                });
+      auto e = partition_point_(b, out_offsets_[s + 1],
+                                [this, &ls, &l](transition_t t)
+                                {
+                                  return !ls.less(l, label_of(t));
+                                });
+      return boost::irange<transition_t>(b, e);
+    }
+
+    /// Indexes of all transitions arriving to state \a s, sorted by
+    /// source state.
+    auto all_in(state_t s) const
+    {
+      assert(has_state(s));
+      return boost::make_iterator_range(in_.begin() + in_offsets_[s],
+                                        in_.begin() + in_offsets_[s + 1]);
+    }
+
+  private:
+    /// The first transition in [b, e) that does not validate \a pred,
+    /// where \a pred holds for a prefix of [b, e).
+    ///
+    /// Boost's integer ranges are not random access with our
+    /// indexes, so we cannot use std::partition_point.
+    template <typename Pred>
+    static transition_t
+    partition_point_(transition_t b, transition_t e, Pred pred)
+    {
+      unsigned lo = b;
+      unsigned hi = e;
+      while (lo < hi)
+        {
+          auto mid = lo + (hi - lo) / 2;
+          if (pred(mid))
+            lo = mid + 1;
+          else
+            hi = mid;
+        }
+      return lo;
+    }
+  };
+  }
+
+  /// Freeze \a aut: a read-only, compact copy of it.
+  template <Automaton Aut>
+  frozen_automaton<context_t_of<Aut>>
+  make_frozen_automaton(const Aut& aut)
+  {
+    return make_shared_ptr<frozen_automaton<context_t_of<Aut>>>(aut);
+  }
+}
@@ -24,6 +24,16 @@ namespace vcsn
   using mutable_automaton
     = std::shared_ptr<detail::mutable_automaton_impl<Context>>;
 
+  // vcsn/core/frozen-automaton.hh
+  namespace detail
+  {
+    template <typename Context>
+    class frozen_automaton_impl;
+  }
+  template <typename Context>
+  using frozen_automaton
+    = std::shared_ptr<detail::frozen_automaton_impl<Context>>;
+
   // vcsn/core/name-automaton.hh
   namespace detail
   {
@@ -2,14 +2,19 @@
 
 #include <algorithm>
 #include <cassert>
+#include <numeric> // iota
 #include <vector>
 
 #include <boost/range/algorithm/find.hpp>
 #include <boost/range/algorithm/find_if.hpp>
+#include <boost/range/algorithm/sort.hpp>
+#include <boost/range/algorithm_ext/erase.hpp>
 #include <boost/range/irange.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #include <vcsn/concepts/automaton.hh>
 #include <vcsn/core/fwd.hh>
+#include <vcsn/core/property-cache.hh>
 #include <vcsn/core/transition.hh>
 #include <vcsn/ctx/context.hh>
 #include <vcsn/ctx/traits.hh>
@@ -71,6 +76,9 @@ namespace vcsn
       tr_cont_t succ;
       /// Incoming transitions.
       tr_cont_t pred;
+      /// Outgoing transitions, sorted by label.  Empty unless the
+      /// label index is enabled.
+      tr_cont_t succ_by_label;
     };
 
     /// All the automaton's states.
@@ -87,6 +95,10 @@ namespace vcsn
     free_store_t transitions_fs_;
     /// Label for initial and final transitions.
     label_t prepost_label_;
+    /// Whether the outgoing transitions are indexed by label.
+    bool label_index_ = false;
+    /// Memoized properties, invalidated by the modifications.
+    mutable property_cache properties_;
 
   public:
     mutable_automaton_impl() = delete;
@@ -114,6 +126,8 @@ namespace vcsn
           std::swap(states_fs_, that.states_fs_);
           std::swap(transitions_, that.transitions_);
           std::swap(transitions_fs_, that.transitions_fs_);
+          std::swap(label_index_, that.label_index_);
+          properties_.swap(that.properties_);
         }
       return *this;
     }
@@ -167,6 +181,19 @@ namespace vcsn
     }
 
 
+    /*--------------.
+    | Properties.   |
+    `--------------*/
+
+    /// The memoized properties of this automaton.
+    ///
+    /// Invalidated by any modification of the automaton.
+    property_cache& properties() const
+    {
+      return properties_;
+    }
+
+
     /*--------------.
     | Statistics.   |
     `--------------*/
@@ -346,6 +373,14 @@ namespace vcsn
       assert(tsucc != succ.end());
       *tsucc = std::move(succ.back());
       succ.pop_back();
+      if (label_index_)
+        {
+          auto& by_label = states_[st.src].succ_by_label;
+          auto i = boost::range::find(label_range_(by_label, st.get_label()),
+                                      t);
+          assert(i != by_label.end());
+          by_label.erase(i);
+        }
     }
 
     /// Remove t from the ingoing transition of the destination state.
@@ -380,6 +415,7 @@ namespace vcsn
     state_t
     new_state()
     {
+      properties_.touch();
       state_t res;
       if (states_fs_.empty())
         {
@@ -428,9 +464,11 @@ namespace vcsn
     {
       assert(has_state(s));
       assert(s > post()); // Cannot erase pre() and post().
+      properties_.touch();
       stored_state_t& ss = states_[s];
       del_transition_container(ss.pred, false);
       del_transition_container(ss.succ, true);
+      ss.succ_by_label.clear();
       ss.succ.emplace_back(null_transition()); // So has_state() can work.
       states_fs_.emplace_back(s);
     }
@@ -451,6 +489,7 @@ namespace vcsn
     set_lazy(state_t s, bool lazy = true)
     {
       assert(has_state(s));
+      properties_.touch();
       stored_state_t& ss = states_[s];
       assert(ss.succ.empty()
              || ss.succ.front() == lazy_transition());
@@ -463,6 +502,7 @@ namespace vcsn
     set_lazy_in(state_t s, bool lazy = true)
     {
       assert(has_state(s));
+      properties_.touch();
       stored_state_t& ss = states_[s];
       assert(ss.pred.empty()
              || ss.pred.front() == lazy_transition());
@@ -516,6 +556,7 @@ namespace vcsn
     del_transition(transition_t t)
     {
       assert(has_transition(t));
+      properties_.touch();
       // Remove transition from source and destination.
       del_transition_from_src(t);
       del_transition_from_dst(t);
@@ -547,11 +588,20 @@ namespace vcsn
     new_transition(state_t src, state_t dst, label_t l, weight_t w)
     {
       assert(!has_transition(src, dst, l));
+      return new_transition_(src, dst, l, w);
+    }
+
+  private:
+    /// Create a transition, without checking for duplicates.
+    transition_t
+    new_transition_(state_t src, state_t dst, label_t l, weight_t w)
+    {
       if (weightset()->is_zero(w))
         return null_transition();
       else
         {
           // FIXME: When src == pre() || dst == post(), label must be empty.
+          properties_.touch();
           transition_t t;
           if (transitions_fs_.empty())
             {
@@ -570,10 +620,17 @@ namespace vcsn
             }
           states_[src].succ.emplace_back(t);
           states_[dst].pred.emplace_back(t);
+          if (label_index_)
+            {
+              // Keep transitions with the same label in creation order.
+              auto& by_label = states_[src].succ_by_label;
+              by_label.insert(label_range_(by_label, l).end(), t);
+            }
           return t;
         }
     }
 
+  public:
     /// Copy the label of a transition between two states, creating a new
     /// transition.
     /// There must not exist a previous transition with same (src, dst,
@@ -642,6 +699,7 @@ namespace vcsn
         }
       else
         {
+          properties_.touch();
           stored_transition_t& st = transitions_[t];
           st.set_label(l);
           st.set_weight(w);
@@ -713,6 +771,132 @@ namespace vcsn
                             weightset()->conv(*aut->weightset(), w));
     }
 
+
+    /*---------------------.
+    | Bulk edition.        |
+    `---------------------*/
+
+    /// Prepare room for \a n states, pre() and post() excluded.
+    void
+    reserve_states(size_t n)
+    {
+      states_.reserve(n + 2);
+    }
+
+    /// Prepare room for \a n transitions, including the initial and
+    /// final ones.
+    void
+    reserve_transitions(size_t n)
+    {
+      transitions_.reserve(n);
+    }
+
+    /// Create transitions without looking for existing ones.
+    ///
+    /// Contrary to new_transition, several transitions may share the
+    /// same (src, dst, label): call finalize() once the insertion is
+    /// complete to merge them.
+    ///
+    /// \param ts  a range of (src, dst, label, weight) tuples.
+    ///            Zero weights are skipped.
+    template <typename Transitions>
+    void
+    new_transitions_unchecked(const Transitions& ts)
+    {
+      for (const auto& t: ts)
+        new_transition_(std::get<0>(t), std::get<1>(t),
+                        std::get<2>(t), std::get<3>(t));
+    }
+
+    /// Merge the transitions with same (src, dst, label), adding their
+    /// weights.  Transitions whose weights sum to zero are removed.
+    ///
+    /// Each merge keeps the transition created first, so the order
+    /// of the outgoing transitions is preserved.  Costs one sort of
+    /// the outgoing transitions of each state.
+    void
+    finalize()
+    {
+      properties_.touch();
+      const auto& ls = *labelset();
+      const auto& ws = *weightset();
+      // The positions in succ of the outgoing transitions of a state.
+      auto pos = std::vector<unsigned>{};
+      auto removed = false;
+      for (auto s = state_t(0); s < states_.size(); ++s)
+        {
+          auto& succ = states_[s].succ;
+          if (succ.size() < 2 || !has_state(s) || is_lazy(s))
+            continue;
+          pos.resize(succ.size());
+          std::iota(pos.begin(), pos.end(), 0u);
+          boost::sort(pos,
+                      [&](unsigned l, unsigned r)
+                      {
+                        const auto& tl = transitions_[succ[l]];
+                        const auto& tr = transitions_[succ[r]];
+                        if (tl.dst != tr.dst)
+                          return tl.dst < tr.dst;
+                        else if (ls.less(tl.get_label(), tr.get_label()))
+                          return true;
+                        else if (ls.less(tr.get_label(), tl.get_label()))
+                          return false;
+                        else
+                          return l < r;
+                      });
+          for (auto i = pos.begin(), end = pos.end(); i != end;)
+            {
+              auto& first = transitions_[succ[*i]];
+              auto j = std::next(i);
+              for (;
+                   j != end
+                     && transitions_[succ[*j]].dst == first.dst
+                     && ls.equal(transitions_[succ[*j]].get_label(),
+                                 first.get_label());
+                   ++j)
+                {
+                  auto w = ws.add(first.get_weight(),
+                                  transitions_[succ[*j]].get_weight());
+                  first.set_weight(w);
+                  erase_transition_(succ[*j]);
+                  removed = true;
+                }
+              if (j != std::next(i) && ws.is_zero(first.get_weight()))
+                erase_transition_(succ[*i]);
+              i = j;
+            }
+        }
+      if (removed)
+        {
+          auto erased = [this](transition_t t)
+            {
+              return (t != null_transition() && t != lazy_transition()
+                      && transitions_[t].src == null_state());
+            };
+          for (auto& ss: states_)
+            {
+              boost::remove_erase_if(ss.succ, erased);
+              boost::remove_erase_if(ss.pred, erased);
+            }
+          // The erased transitions are recycled: rebuild the label
+          // index from scratch rather than trusting it.
+          if (label_index_)
+            for (auto s: all_states())
+              if (!is_lazy(s))
+                index_labels_(s);
+        }
+    }
+
+  private:
+    /// Mark \a t as erased, without updating its states.
+    void
+    erase_transition_(transition_t t)
+    {
+      transitions_[t].src = null_state();
+      transitions_fs_.emplace_back(t);
+    }
+
+  public:
     /// Print a transition, for debugging.
     std::ostream& print(transition_t t, std::ostream& o = std::cout,
                         format fmt = {}) const
@@ -764,7 +948,10 @@ namespace vcsn
           return null_transition();
         }
       else
-        transitions_[t].set_weight(w);
+        {
+          properties_.touch();
+          transitions_[t].set_weight(w);
+        }
       return t;
     }
 
@@ -815,6 +1002,73 @@ namespace vcsn
       return state_range(b, e, [](state_t) { return true; });
     }
 
+    /// The subrange of \a by_label whose transitions are labeled
+    /// by \a l.
+    auto label_range_(const tr_cont_t& by_label, const label_t& l) const
+    {
+      const auto& ls = *labelset();
+      struct compare
+      {
+        bool operator()(transition_t t, const label_t& l) const
+        {
+          return ls.less(aut.label_of(t), l);
+        }
+        bool operator()(const label_t& l, transition_t t) const
+        {
+          return ls.less(l, aut.label_of(t));
+        }
+        const labelset_t& ls;
+        const mutable_automaton_impl& aut;
+      };
+      auto r = std::equal_range(by_label.begin(), by_label.end(), l,
+                                compare{ls, *this});
+      return boost::make_iterator_range(r.first, r.second);
+    }
+
+  public:
+    /// Whether the outgoing transitions are indexed by label.
+    bool label_index() const
+    {
+      return label_index_;
+    }
+
+    /// Enable or disable the index of outgoing transitions by label.
+    ///
+    /// When enabled, out(s, l) costs O(log d) instead of O(d), where
+    /// d is the out-degree of s, at the expense of some memory and of
+    /// a slower new_transition/del_transition.
+    void set_label_index(bool enable = true)
+    {
+      if (enable != label_index_)
+        {
+          label_index_ = enable;
+          for (auto s: all_states())
+            if (enable && !is_lazy(s))
+              index_labels_(s);
+            else
+              {
+                states_[s].succ_by_label.clear();
+                states_[s].succ_by_label.shrink_to_fit();
+              }
+        }
+    }
+
+  private:
+    /// Build the label index of state \a s from its outgoing
+    /// transitions.
+    void index_labels_(state_t s)
+    {
+      auto& by_label = states_[s].succ_by_label;
+      by_label = states_[s].succ;
+      const auto& ls = *labelset();
+      std::stable_sort(by_label.begin(), by_label.end(),
+                       [this, &ls](transition_t t1, transition_t t2)
+                       {
+                         return ls.less(label_of(t1), label_of(t2));
+                       });
+      by_label.shrink_to_fit();
+    }
+
   public:
     /// All states including pre()/post().
     /// Guaranteed in increasing order.
@@ -858,6 +1112,29 @@ namespace vcsn
       return states_[s].succ;
     }
 
+    /// Indexes of all transitions leaving state \a s on label \a l.
+    /// Uses the label index if enabled, otherwise filters all_out(s).
+    /// Invalidated by del_transition() and del_state().
+    auto
+    out(state_t s, label_t l) const
+    {
+      assert(has_state(s));
+      const auto& ss = states_[s];
+      // On small out-degrees, a linear scan is faster than a binary
+      // search.
+      const bool indexed = label_index_ && 8 < ss.succ_by_label.size();
+      auto r = (indexed
+                ? label_range_(ss.succ_by_label, l)
+                : boost::make_iterator_range(ss.succ.begin(), ss.succ.end()));
+      // Filter only when not indexed, but keep a single return type.
+      return make_container_filter_range
+        (r,
+         [this, l, indexed](transition_t t)
+         {
+           return indexed || labelset()->equal(label_of(t), l);
+         });
+    }
+
     /// Indexes of all transitions arriving to state \a s.
     /// Invalidated by del_transition() and del_state().
     container_range<const tr_cont_t&>
@@ -29,6 +29,7 @@ namespace vcsn
       using fresh_automaton_t = fresh_automaton_t_of<automaton_t, Ctx>;
       using label_t = label_t_of<automaton_t>;
       using super_t = automaton_decorator<fresh_automaton_t<>>;
+      using super_t::properties;
 
       /// The underlying state type.
       using state_t = state_t_of<automaton_t>;
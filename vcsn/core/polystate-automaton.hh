@@ -35,6 +35,7 @@ namespace vcsn
       template <typename Ctx = context_t>
       using fresh_automaton_t = fresh_automaton_t_of<Aut, Ctx>;
       using super_t = automaton_decorator<fresh_automaton_t<>>;
+      using super_t::properties;
       using state_bimap_t
         = state_bimap<polynomialset<context<stateset<Aut>,
                                             weightset_t_of<Aut>>, Kind>,
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#include <boost/optional.hpp>
+
+#include <vcsn/concepts/automaton.hh>
+#include <vcsn/misc/type_traits.hh> // detect
+
+namespace vcsn
+{
+  /// The properties of automata that may be memoized.
+  ///
+  /// Completeness is not: it also depends on the alphabet, which,
+  /// when open and shared, may grow without the automaton being
+  /// modified.
+  enum class property
+  {
+    accessible,
+    ambiguous,
+    deterministic,
+    proper,
+    valid,
+  };
+
+  namespace detail
+  {
+    /// Memoized properties of an automaton.
+    ///
+    /// The automaton calls touch() on each modification, which
+    /// invalidates all the properties known so far.  The properties
+    /// may be queried and recorded concurrently (as algorithms on a
+    /// const automaton may run in several threads), but not while the
+    /// automaton is being modified.
+    class property_cache
+    {
+    public:
+      /// The modification counter.
+      using stamp_t = std::uint64_t;
+
+      property_cache()
+      {
+        clear();
+      }
+
+      property_cache(const property_cache&) = delete;
+      property_cache& operator=(const property_cache&) = delete;
+
+      property_cache(property_cache&& that)
+        : property_cache()
+      {
+        swap(that);
+      }
+
+      /// Exchange the properties with those of \a that.
+      void swap(property_cache& that)
+      {
+        std::swap(stamp_, that.stamp_);
+        for (auto i = size_t{0}; i < entries_.size(); ++i)
+          {
+            auto e = entries_[i].load(std::memory_order_relaxed);
+            auto f = that.entries_[i].load(std::memory_order_relaxed);
+            entries_[i].store(f, std::memory_order_relaxed);
+            that.entries_[i].store(e, std::memory_order_relaxed);
+          }
+      }
+
+      /// The number of modifications of the automaton so far.
+      stamp_t stamp() const
+      {
+        return stamp_;
+      }
+
+      /// Record a modification of the automaton: forget everything.
+      void touch()
+      {
+        ++stamp_;
+      }
+
+      /// Forget everything.
+      void clear()
+      {
+        for (auto& e: entries_)
+          e.store(0, std::memory_order_relaxed);
+      }
+
+      /// The value of \a p, if known.
+      boost::optional<bool> get(property p) const
+      {
+        auto e = entries_[index_(p)].load(std::memory_order_relaxed);
+        if (e >> 1 == stamp_)
+          return bool(e & 1);
+        else
+          return boost::none;
+      }
+
+      /// Record the value of \a p, as computed on the automaton as it
+      /// was at \a stamp.
+      ///
+      /// If the automaton was modified since, the value is ignored.
+      void set(property p, bool v, stamp_t stamp)
+      {
+        entries_[index_(p)].store(stamp << 1 | v, std::memory_order_relaxed);
+      }
+
+      /// Record the value of \a p for the automaton as it is now.
+      void set(property p, bool v)
+      {
+        set(p, v, stamp_);
+      }
+
+    private:
+      static size_t index_(property p)
+      {
+        return static_cast<size_t>(p);
+      }
+
+      /// The number of properties.
+      static constexpr size_t size_ = size_t(property::valid) + 1;
+      /// Starts at one: an entry 0 is never valid.
+      stamp_t stamp_ = 1;
+      /// For each property, the stamp at which it was computed, and
+      /// its value in the least significant bit.
+      std::array<std::atomic<stamp_t>, size_> entries_;
+    };
+
+    /// The type of the property cache of an automaton.
+    template <typename Aut>
+    using properties_mem_fn_t = decltype(std::declval<Aut>()->properties());
+
+    /// Whether \a Aut features a property cache.
+    template <typename Aut>
+    using has_properties_mem_fn = detect<Aut, properties_mem_fn_t>;
+
+    template <Automaton Aut, typename Fun>
+    bool cached_property_(const Aut& aut, property p, Fun compute,
+                          std::true_type)
+    {
+      auto& cache = aut->properties();
+      if (auto res = cache.get(p))
+        return *res;
+      else
+        {
+          // Lazy automata may be expanded by compute: save the stamp
+          // of the automaton on which the computation started.
+          auto stamp = cache.stamp();
+          auto v = compute();
+          cache.set(p, v, stamp);
+          return v;
+        }
+    }
+
+    template <Automaton Aut, typename Fun>
+    bool cached_property_(const Aut&, property, Fun compute, std::false_type)
+    {
+      return compute();
+    }
+
+    template <Automaton Aut>
+    void set_property_(const Aut& aut, property p, bool v, std::true_type)
+    {
+      aut->properties().set(p, v);
+    }
+
+    template <Automaton Aut>
+    void set_property_(const Aut&, property, bool, std::false_type)
+    {}
+  }
+
+  /// Whether \a aut has the property \a p.
+  ///
+  /// Use the memoized value if \a aut features a property cache and
+  /// was not modified since it was computed.  Otherwise, call \a
+  /// compute, and memoize its result.
+  template <Automaton Aut, typename Fun>
+  bool cached_property(const Aut& aut, property p, Fun compute)
+  {
+    return detail::cached_property_(aut, p, compute,
+                                    detail::has_properties_mem_fn<Aut>{});
+  }
+
+  /// Record that \a aut has (or has not) the property \a p.
+  ///
+  /// For algorithms that know the properties of their result.
+  /// No-op if \a aut does not feature a property cache.
+  template <Automaton Aut>
+  void set_property(const Aut& aut, property p, bool v = true)
+  {
+    detail::set_property_(aut, p, v, detail::has_properties_mem_fn<Aut>{});
+  }
+}
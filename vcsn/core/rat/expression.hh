@@ -9,6 +9,7 @@
 #include <vcsn/ctx/context.hh>
 #include <vcsn/ctx/traits.hh>
 #include <vcsn/labelset/tupleset.hh>
+#include <vcsn/misc/functional.hh> // hash_combine_hash
 #include <vcsn/misc/symbol.hh>
 
 namespace vcsn
@@ -91,6 +92,38 @@ namespace vcsn
       using const_visitor = vcsn::rat::const_visitor<context_t>;
 
       virtual void accept(const_visitor& v) const = 0;
+
+      /// The (structural) hash of this expression.
+      ///
+      /// Computed once, when the node is built: since the children
+      /// are built first, it costs O(1) per node.
+      size_t hash() const
+      {
+        return hash_;
+      }
+
+      /// Whether this node is in a hash-consing table, hence shared
+      /// by equal expressions: it must not be modified.
+      bool is_consed() const
+      {
+        return consed_;
+      }
+
+    protected:
+      /// Combine \a h into the hash of this node.
+      void hash_combine_(size_t h)
+      {
+        hash_combine_hash(hash_, h);
+      }
+
+      /// The hash of this node.
+      size_t hash_ = 0;
+
+    private:
+      template <typename Ctx>
+      friend class expressionset_impl;
+      /// Whether this node is in a hash-consing table.
+      mutable bool consed_ = false;
     };
 
     /*--------.
@@ -155,7 +188,9 @@ namespace vcsn
       template <typename... Vs>
       variadic(Vs&&... vs)
         : sub_{std::forward<Vs>(vs)...}
-      {}
+      {
+        compute_hash_();
+      }
 
       /// Return a copy of children.
       values_t subs() const;
@@ -163,6 +198,9 @@ namespace vcsn
       virtual void accept(typename super_t::const_visitor& v) const;
 
     private:
+      /// Compute the hash of this node.
+      void compute_hash_();
+
       values_t sub_;
     };
 
@@ -200,7 +238,14 @@ namespace vcsn
       template <typename... Args>
       tuple(Args&&... args)
         : sub_{std::forward<Args>(args)...}
-      {};
+      {
+        this->hash_combine_(size_t(type_t::tuple));
+        detail::for_(sub_,
+                     [this](const auto& v)
+                     {
+                       this->hash_combine_(v->hash());
+                     });
+      };
       virtual type_t type() const { return type_t::tuple; };
 
       virtual void accept(typename super_t::const_visitor& v) const
@@ -269,6 +314,8 @@ namespace vcsn
 
       const value_t sub() const;
       const weight_t& weight() const;
+      /// Change the weight.  Refused on hash-consed nodes: build a
+      /// new node instead.
       void set_weight(weight_t w);
 
       weight_node(weight_t w, value_t exp);
@@ -276,6 +323,9 @@ namespace vcsn
       virtual void accept(typename super_t::const_visitor& v) const;
 
     private:
+      /// Compute the hash of this node.
+      void compute_hash_();
+
       value_t sub_;
       weight_t weight_;
     };
@@ -332,6 +382,8 @@ namespace vcsn
       using value_t = typename super_t::value_t;
       using type_t = typename super_t::type_t;
 
+      constant();
+
       virtual type_t type() const { return Type; };
 
       virtual void accept(typename super_t::const_visitor& v) const;
@@ -2,6 +2,7 @@
 
 #include <vcsn/core/rat/expression.hh>
 #include <vcsn/core/rat/visitor.hh>
+#include <vcsn/misc/raise.hh>
 
 namespace vcsn
 {
@@ -23,7 +24,10 @@ namespace vcsn
 
     DEFINE_CTOR(atom)(const label_t& value)
       : value_(value)
-    {}
+    {
+      this->hash_combine_(size_t(type_t::atom));
+      this->hash_combine_(labelset_t_of<Context>::hash(value_));
+    }
 
     DEFINE(atom)::accept(typename super_t::const_visitor& v) const
       -> void
@@ -44,7 +48,11 @@ namespace vcsn
     DEFINE_CTOR(name)(value_t sub, symbol name)
       : sub_{std::move(sub)}
       , name_{name}
-    {}
+    {
+      this->hash_combine_(size_t(type_t::name));
+      this->hash_combine_(hash_value(name_));
+      this->hash_combine_(sub_->hash());
+    }
 
     DEFINE(name)::sub() const
       -> const value_t
@@ -84,7 +92,17 @@ namespace vcsn
 
     DEFINE_CTOR(variadic)(values_t ns)
       : sub_(std::move(ns))
-    {}
+    {
+      compute_hash_();
+    }
+
+    DEFINE(variadic)::compute_hash_()
+      -> void
+    {
+      this->hash_combine_(size_t(Type));
+      for (const auto& v: sub_)
+        this->hash_combine_(v->hash());
+    }
 
 
     DEFINE(variadic)::begin() const
@@ -147,7 +165,10 @@ namespace vcsn
 
     DEFINE_CTOR(unary)(value_t sub)
       : sub_(sub)
-    {}
+    {
+      this->hash_combine_(size_t(Type));
+      this->hash_combine_(sub_->hash());
+    }
 
     DEFINE(unary)::sub() const
       -> const value_t
@@ -168,7 +189,18 @@ namespace vcsn
     DEFINE_CTOR(weight_node)(weight_t weight, value_t sub)
       : sub_(std::move(sub))
       , weight_(weight)
-    {}
+    {
+      compute_hash_();
+    }
+
+    DEFINE(weight_node)::compute_hash_()
+      -> void
+    {
+      this->hash_ = 0;
+      this->hash_combine_(size_t(Type));
+      this->hash_combine_(weightset_t_of<Context>::hash(weight_));
+      this->hash_combine_(sub_->hash());
+    }
 
     DEFINE(weight_node)::sub() const
       -> const value_t
@@ -185,7 +217,10 @@ namespace vcsn
     DEFINE(weight_node)::set_weight(weight_t w)
       -> void
     {
+      require(!this->is_consed(),
+              "set_weight: cannot modify a hash-consed expression");
       weight_ = w;
+      compute_hash_();
     }
 
     DEFINE(weight_node)::accept(typename super_t::const_visitor& v) const
@@ -199,6 +234,11 @@ namespace vcsn
     | constant.  |
     `-----------*/
 
+    DEFINE_CTOR(constant)()
+    {
+      this->hash_combine_(size_t(Type));
+    }
+
     DEFINE(constant)::accept(typename super_t::const_visitor& v) const
       -> void
     {
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <unordered_set>
 
 #include <vcsn/core/rat/expression.hh>
 #include <vcsn/core/rat/identities.hh>
@@ -10,6 +13,8 @@
 #include <vcsn/labelset/labelset.hh>
 #include <vcsn/labelset/letterset.hh>
 #include <vcsn/labelset/oneset.hh>
+#include <vcsn/misc/arena.hh>
+#include <vcsn/misc/functional.hh>
 #include <vcsn/misc/raise.hh>
 #include <vcsn/misc/star-status.hh>
 #include <vcsn/misc/symbol.hh>
@@ -128,6 +133,33 @@ namespace vcsn
     /// Accessor to the weightset.
     const weightset_ptr& weightset() const;
 
+    /// Whether hash-consing is enabled.
+    bool hash_consing() const;
+
+    /// Enable or disable hash-consing.
+    ///
+    /// When enabled, the equal expressions built by this
+    /// expressionset (and by its copies made afterwards) share the
+    /// same node, so that comparing them is mostly a pointer
+    /// comparison.  These nodes are kept alive as long as the
+    /// expressionset, and cannot be modified.  Constants and atoms,
+    /// which are built by static functions, are not shared.
+    void set_hash_consing(bool enable = true);
+
+    /// Whether the nodes are allocated in an arena.
+    bool has_arena() const;
+
+    /// Enable or disable the allocation of the nodes in an arena.
+    ///
+    /// When enabled, the nodes built by this expressionset (and by its
+    /// copies made afterwards) are allocated, with their reference
+    /// counters, in a memory pool shared by these expressionsets.  The
+    /// pool is released at once when all of them, and all the nodes,
+    /// are gone.  Unless \a thread_safe, nodes must not be built or
+    /// destroyed concurrently.  Constants and atoms, which are built
+    /// by static functions, are not allocated in the arena.
+    void set_arena(bool enable = true, bool thread_safe = false);
+
     /// When used as a LabelSet.
     static value_t special()
     {
@@ -496,10 +528,28 @@ namespace vcsn
     };
 
   private:
+    /// Build a node, shared if hash-consing is enabled.
+    template <typename Node, typename... Args>
+    auto make_node_(Args&&... args) const -> value_t;
+
     /// The context of the expressions.
     context_t ctx_;
     /// The set of rewriting rules to apply.
     const identities_t ids_;
+    /// The table of shared nodes, if hash-consing is enabled.
+    ///
+    /// Shared by the copies of the expressionset, which may be used
+    /// concurrently, hence the lock.
+    struct hash_cons_t
+    {
+      std::mutex mutex;
+      std::unordered_set<value_t,
+                         vcsn::hash<self_t>,
+                         vcsn::equal_to<self_t>> table;
+    };
+    std::shared_ptr<hash_cons_t> hash_cons_;
+    /// The pool of the nodes, if enabled.
+    std::shared_ptr<arena> arena_;
   };
   } // rat::
 
@@ -630,6 +680,13 @@ namespace vcsn
     : is_multitape<Context>
   {};
 
+  /// The nodes of an expressionset may be shared (hash-consing) or
+  /// allocated in an arena.
+  template <typename Context>
+  struct is_thread_safe<expressionset<Context>>
+    : std::false_type
+  {};
+
   /// The meet of two expressionsets.
   template <typename Ctx1, typename Ctx2>
   auto
@@ -136,6 +136,58 @@ namespace vcsn
     return ctx_.weightset();
   }
 
+  DEFINE::hash_consing() const
+    -> bool
+  {
+    return bool(hash_cons_);
+  }
+
+  DEFINE::set_hash_consing(bool enable)
+    -> void
+  {
+    if (!enable)
+      hash_cons_ = nullptr;
+    else if (!hash_cons_)
+      hash_cons_ = std::make_shared<hash_cons_t>();
+  }
+
+  DEFINE::has_arena() const
+    -> bool
+  {
+    return bool(arena_);
+  }
+
+  DEFINE::set_arena(bool enable, bool thread_safe)
+    -> void
+  {
+    if (enable)
+      arena_ = make_arena(thread_safe);
+    else
+      arena_ = nullptr;
+  }
+
+  template <typename Context>
+  template <typename Node, typename... Args>
+  auto
+  expressionset_impl<Context>::make_node_(Args&&... args) const
+    -> value_t
+  {
+    auto res
+      = arena_
+      ? value_t{std::allocate_shared<Node>(arena_allocator<Node>{*arena_},
+                                           std::forward<Args>(args)...)}
+      : value_t{std::make_shared<Node>(std::forward<Args>(args)...)};
+    if (hash_cons_)
+      {
+        auto&& lock = std::lock_guard<std::mutex>{hash_cons_->mutex};
+        const auto& n = *hash_cons_->table.insert(res).first;
+        n->consed_ = true;
+        return n;
+      }
+    else
+      return res;
+  }
+
   DEFINE::atom(const label_t& v)
     -> value_t
   {
@@ -148,7 +200,7 @@ namespace vcsn
   DEFINE::name(const value_t& v, symbol name) const
     -> value_t
   {
-    return std::make_shared<name_t>(v, name);
+    return make_node_<name_t>(v, name);
   }
 
   DEFINE::zero()
@@ -214,7 +266,7 @@ namespace vcsn
       res = add_linear_(l, r);
 
     else
-      res = std::make_shared<add_t>(gather_<type_t::add>(l, r));
+      res = make_node_<add_t>(gather_<type_t::add>(l, r));
     return res;
   }
 
@@ -259,7 +311,7 @@ namespace vcsn
     else if (vs.size() == 1)
       return vs[0];
     else
-      return std::make_shared<add_t>(std::move(vs));
+      return make_node_<add_t>(std::move(vs));
   }
 
   DEFINE::add_linear_(const add_t& s1, const add_t& s2) const
@@ -320,9 +372,9 @@ namespace vcsn
     else if (auto rs = std::dynamic_pointer_cast<const add_t>(r))
       res = add_linear_(*rs, l);
     else if (less_linear(l, r))
-      res = std::make_shared<add_t>(l, r);
+      res = make_node_<add_t>(l, r);
     else if (less_linear(r, l))
-      res = std::make_shared<add_t>(r, l);
+      res = make_node_<add_t>(r, l);
     else
       {
         auto w = weightset()->add(possibly_implicit_lweight_(l),
@@ -412,7 +464,7 @@ namespace vcsn
       }
 
     else
-      res = std::make_shared<mul_t>(gather_<type_t::mul>(l, r));
+      res = make_node_<mul_t>(gather_<type_t::mul>(l, r));
     return res;
   }
 
@@ -505,7 +557,7 @@ namespace vcsn
 
     // General case.
     else
-      res = std::make_shared<compose_t>(gather_<type_t::compose>(l, r));
+      res = make_node_<compose_t>(gather_<type_t::compose>(l, r));
     return res;
   }
 
@@ -563,7 +615,7 @@ namespace vcsn
 
     // General case: E & F.
     else
-      res = std::make_shared<conjunction_t>(gather_<type_t::conjunction>(l, r));
+      res = make_node_<conjunction_t>(gather_<type_t::conjunction>(l, r));
     return res;
   }
 
@@ -585,7 +637,7 @@ namespace vcsn
       res = r;
 
     else
-      res = std::make_shared<ldivide_t>(l, r);
+      res = make_node_<ldivide_t>(l, r);
     return res;
   }
 
@@ -637,7 +689,7 @@ namespace vcsn
 
     // General case.
     else
-      return std::make_shared<tuple_t>(std::forward<Value>(v)...);
+      return make_node_<tuple_t>(std::forward<Value>(v)...);
   }
 
   DEFINE::infiltrate(const value_t& l, const value_t& r) const
@@ -663,7 +715,7 @@ namespace vcsn
 
     else
       res =
-        std::make_shared<infiltrate_t>(gather_<type_t::infiltrate>(l, r));
+        make_node_<infiltrate_t>(gather_<type_t::infiltrate>(l, r));
     return res;
   }
 
@@ -689,7 +741,7 @@ namespace vcsn
       res = l;
 
     else
-      res = std::make_shared<shuffle_t>(gather_<type_t::shuffle>(l, r));
+      res = make_node_<shuffle_t>(gather_<type_t::shuffle>(l, r));
     return res;
   }
 
@@ -745,7 +797,7 @@ namespace vcsn
     // When associative, instead of repeated multiplication,
     // immediately create n copies of E.
     else if (ids_.is_associative())
-      res = std::make_shared<mul_t>(n, e);
+      res = make_node_<mul_t>(n, e);
 
     // Default case: E{n} = ((..(EE)...)E.
     else
@@ -821,7 +873,7 @@ namespace vcsn
         if (ls.size() == 1)
           return ls.front();
         else
-          return std::make_shared<mul_t>(std::move(ls));
+          return make_node_<mul_t>(std::move(ls));
       }
     else
       // Handle all the trivial identities.
@@ -845,7 +897,7 @@ namespace vcsn
 
     else
       {
-        res = std::make_shared<star_t>(e);
+        res = make_node_<star_t>(e);
         if (ids_.is_distributive() && !is_valid(*this, res))
           raise_not_starrable(self(), e);
       }
@@ -882,7 +934,7 @@ namespace vcsn
       res = down_pointer_cast<const complement_t>(e)->sub();
 
     else
-      res = std::make_shared<complement_t>(e);
+      res = make_node_<complement_t>(e);
 
     return res;
   }
@@ -917,7 +969,7 @@ namespace vcsn
       res = down_pointer_cast<const transposition_t>(e)->sub();
 
     else
-      res = std::make_shared<transposition_t>(e);
+      res = make_node_<transposition_t>(e);
     return res;
   }
 
@@ -955,12 +1007,12 @@ namespace vcsn
         auto addends = values_t{};
         for (const auto& a: *s)
           addends.emplace_back(lweight(w, a));
-        res = std::make_shared<add_t>(std::move(addends));
+        res = make_node_<add_t>(std::move(addends));
       }
 
     // General case: <k>E.
     else
-      res = std::make_shared<lweight_t>(w, e);
+      res = make_node_<lweight_t>(w, e);
 
     return res;
   }
@@ -1002,7 +1054,7 @@ namespace vcsn
 
     // General case: E<k>.
     else
-      res = std::make_shared<rweight_t>(w, e);
+      res = make_node_<rweight_t>(w, e);
 
     return res;
   }
@@ -1059,7 +1111,9 @@ namespace vcsn
   DEFINE::equal(const value_t& lhs, const value_t& rhs)
     -> bool
   {
-    return compare(lhs, rhs) == 0;
+    // Nodes carry their hash: avoid traversing different expressions.
+    return (lhs == rhs
+            || (lhs->hash() == rhs->hash() && compare(lhs, rhs) == 0));
   }
 
   DEFINE::hash(const value_t& v)
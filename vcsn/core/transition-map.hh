@@ -1,8 +1,12 @@
 #pragma once
 
+#include <algorithm> // stable_sort
 #include <type_traits>
+#include <utility> // pair
 #include <vector>
 
+#include <boost/range/iterator_range.hpp>
+
 #include <vcsn/concepts/automaton.hh>
 #include <vcsn/core/automaton.hh> // states_size
 #include <vcsn/misc/map.hh> // vcsn::less
@@ -192,5 +196,100 @@ namespace vcsn
       /// The result weightset.
       const weightset_t& ws_;
     };
+
+
+    /// Cache the outgoing transitions of an automaton as contiguous
+    /// arrays sorted by label, including the transitions to post().
+    ///
+    /// Cheaper to build and to scan than transition_map, but it
+    /// cannot be looked up by label: meant for merge joins.
+    ///
+    /// \tparam Aut
+    ///    The automaton type.
+    /// \tparam WeightSet
+    ///    The set of weights into which the weights will be converted.
+    template <Automaton Aut,
+              typename WeightSet = weightset_t_of<Aut>>
+    class sorted_transitions
+    {
+    public:
+      /// State index type.
+      using state_t = state_t_of<Aut>;
+      using label_t = label_t_of<Aut>;
+      using weightset_t = WeightSet;
+      using weight_t = typename weightset_t::value_t;
+
+      /// Outgoing signature: label, weight, destination.
+      struct transition
+      {
+        label_t label;
+        /// The (converted) weight.
+        weight_t wgt;
+        weight_t weight() const { return wgt; }
+        state_t dst;
+      };
+
+      /// A range of transitions.
+      using transitions_t = boost::iterator_range<const transition*>;
+
+      sorted_transitions(const Aut& aut, const weightset_t& ws)
+        : ranges_(states_size(aut), unknown_())
+        , aut_(aut)
+        , ws_(ws)
+      {}
+
+      /// Outgoing transitions of state \a s, sorted by label, and in
+      /// the order of all_out for a given label.
+      ///
+      /// Valid until the next call.
+      transitions_t operator[](state_t s)
+      {
+        // We might be working on a lazy automaton.
+        if (ranges_.size() <= s)
+          ranges_.resize(s + 1, unknown_());
+        if (ranges_[s] == unknown_())
+          ranges_[s] = build_(s);
+        const auto* data = transitions_.data();
+        return {data + ranges_[s].first, data + ranges_[s].second};
+      }
+
+    private:
+      /// Begin and end indexes in transitions_.
+      using range_t = std::pair<size_t, size_t>;
+
+      static constexpr range_t unknown_()
+      {
+        return {size_t(-1), size_t(-1)};
+      }
+
+      /// Append the outgoing transitions of \a s.
+      range_t build_(state_t s)
+      {
+        auto res = range_t{transitions_.size(), 0};
+        for (auto t: all_out(aut_, s))
+          transitions_.push_back({aut_->label_of(t),
+                                  ws_.conv(*aut_->weightset(),
+                                           aut_->weight_of(t)),
+                                  aut_->dst_of(t)});
+        res.second = transitions_.size();
+        const auto& ls = *aut_->labelset();
+        std::stable_sort(transitions_.begin() + res.first,
+                         transitions_.end(),
+                         [&ls](const transition& l, const transition& r)
+                         {
+                           return ls.less(l.label, r.label);
+                         });
+        return res;
+      }
+
+      /// For each state number, its range in transitions_.
+      std::vector<range_t> ranges_;
+      /// The transitions of all the states.
+      std::vector<transition> transitions_;
+      /// The automaton whose transitions are cached.
+      Aut aut_;
+      /// The result weightset.
+      const weightset_t& ws_;
+    };
   }
 }
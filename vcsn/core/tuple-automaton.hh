@@ -79,6 +79,7 @@ namespace vcsn
 
       /// The result automaton.
       using super_t::aut_;
+      using super_t::properties;
 
       tuple_automaton_impl(const automaton_t& aut, const Auts&... auts)
         : super_t(aut)
@@ -154,6 +154,12 @@ namespace vcsn
     : is_multitape<LabelSet>
   {};
 
+  template <typename LabelSet, typename WeightSet>
+  struct is_thread_safe<context<LabelSet, WeightSet>>
+    : bool_constant<is_thread_safe<LabelSet>{}
+                    && is_thread_safe<WeightSet>{}>
+  {};
+
   template <typename LabelSet, typename WeightSet>
   struct number_of_tapes<context<LabelSet, WeightSet>>
     : number_of_tapes<LabelSet>
@@ -57,6 +57,7 @@
 #include <vcsn/algos/to-expression.hh>
 #include <vcsn/algos/transpose.hh>
 #include <vcsn/algos/u.hh>
+#include <vcsn/algos/vbin.hh>
 #include <vcsn/algos/weight.hh>
 
 #include <vcsn/core/rat/identities.hh>
@@ -387,6 +388,7 @@ namespace vcsn
         REGISTER(print_weight, ws_t, std::ostream, const std::string);
         REGISTER(read_label, ctx_t, std::istream, bool);
         REGISTER(read_polynomial, ctx_t, std::istream);
+        REGISTER(read_vbin, ctx_t, std::istream);
         REGISTER(read_weight, ctx_t, std::istream);
         REGISTER(to_expression_class, ctx_t, rat::identities, const letter_class_t, bool);
         REGISTER(to_expression_label, ctx_t, rat::identities, ls_t);
@@ -118,6 +118,20 @@ namespace vcsn
     : std::false_type
   {};
 
+  /*------------------.
+  | is_thread_safe.   |
+  `------------------*/
+
+  /// Whether the values of a ValueSet, or of a context, can be built
+  /// concurrently by several threads.
+  ///
+  /// Expressions are not: their nodes may be hash-consed, or
+  /// allocated in an arena.
+  template <typename ValueSet>
+  struct is_thread_safe
+    : std::true_type
+  {};
+
 
   /*-------------------.
   | Number of tapes.   |
@@ -152,9 +152,14 @@ namespace vcsn
     ///
     /// \param lhs   the left transducer
     /// \param rhs   the right transducer
-    /// \param lazy  whether to perform the computations on demand.
+    /// \param algo  how to compute the result
+    ///   - "standard"    build the accessible part of the result
+    ///   - "lazy"        perform the computations on demand
+    ///   - "parallel"    like "standard", but compute the transitions
+    ///                   on several threads
+    ///   - "auto"        same as "standard"
     automaton compose(const automaton& lhs, const automaton& rhs,
-                      bool lazy = false);
+                      const std::string& algo = "auto");
 
     /// The composition of two contexts.
     context compose(const context& lhs, const context& rhs);
@@ -333,6 +338,34 @@ namespace vcsn
     /// Evaluate \a p on \a aut.
     weight evaluate(const automaton& aut, const polynomial& p);
 
+    /// Evaluate the \a words on \a aut.
+    ///
+    /// \param aut          the automaton
+    /// \param words        the words to evaluate
+    /// \param num_threads  the number of threads to use, 0 for as many
+    ///                     as hardware threads.
+    /// \returns  the weights of the words, in the same order.
+    std::vector<weight>
+    evaluate_batch(const automaton& aut,
+                   const std::vector<std::string>& words,
+                   unsigned num_threads = 1);
+
+    /// Evaluate the text read from \a is, and print the results on \a os.
+    ///
+    /// The active states are kept between the chunks of the text, so
+    /// it is never loaded as a whole.  Mapped files are read in place.
+    ///
+    /// \param aut   the automaton, labeled by characters
+    /// \param is    the text to evaluate
+    /// \param os    where to print the results
+    /// \param mode  "lines" to print the weight of each line,
+    ///              "positions" to print the end positions of the
+    ///              factors with a non-zero weight, followed by their
+    ///              weight.
+    void evaluate_stream(const automaton& aut,
+                         std::istream& is, std::ostream& os,
+                         const std::string& mode = "lines");
+
     /// Distribute product over addition recursively under the starred
     /// subexpressions and group the equal monomials.
     expression expand(const expression& e);
@@ -349,9 +382,22 @@ namespace vcsn
     /// The subautomaton based on \a aut, with only states in \a ss visible.
     automaton filter(const automaton& aut, const std::vector<unsigned>& ss);
 
+    /// A hash of \a aut, invariant under the renumbering of its
+    /// states.
+    ///
+    /// Isomorphic automata have the same fingerprint.
+    std::size_t fingerprint(const automaton& aut);
+
     /// Focus on a specific tape of a tupleset automaton.
     automaton focus(const automaton& aut, unsigned tape);
 
+    /// A read-only, compact, copy of \a aut.
+    ///
+    /// Transitions are stored contiguously, grouped by source state
+    /// and sorted by label, which speeds up read-only algorithms such
+    /// as evaluate.
+    automaton freeze(const automaton& aut);
+
     /// Whether the automaton has the twins property.
     bool has_twins_property(const automaton& aut);
 
@@ -636,6 +682,13 @@ namespace vcsn
     label make_word(const context& ctx, const std::string& s,
                     const std::string& format = "default");
 
+    /// The weight of the word \a w in \a exp.
+    ///
+    /// Builds a deterministic automaton on the fly, from the
+    /// expansions of \a exp, with a bounded cache of states: only the
+    /// states visited by \a w are computed.  Requires a free labelset.
+    weight match(const expression& exp, const word& w);
+
     /// Multiply (concatenate) two automata.
     ///
     /// \param lhs   an automaton.
@@ -754,6 +807,7 @@ namespace vcsn
     ///    - "fado"     FAdo format.
     ///    - "grail"    Grail format.
     ///    - "tikz"     LaTeX's TikZ format.
+    ///    - "vbin"     Binary format, fast to load.
     std::ostream& print(const automaton& aut, std::ostream& out = std::cout,
                         const std::string& format = "default");
 
@@ -914,7 +968,7 @@ namespace vcsn
     /// Read an automaton from a stream.
     /// \param is      the input stream.
     /// \param format  its format ("auto", "daut", "default", "dot",
-    ///                "efsm", "fado", "grail").  "default" means
+    ///                "efsm", "fado", "grail", "vbin").  "default" means
     ///                "auto": try to guess the format.
     /// \param strip   whether to return a stripped automaton,
     ///                or a named automaton.
@@ -998,6 +1052,15 @@ namespace vcsn
     /// \param algo   the specific algorithm to use.
     automaton scc(const automaton& aut, const std::string& algo = "auto");
 
+    /// The first factor of \a w whose weight in \a exp is not zero.
+    ///
+    /// Among the factors that end first, the longest one.  Requires a
+    /// free labelset.
+    ///
+    /// \returns  the positions of its first letter and past its last
+    ///           letter, or an empty vector if there is none.
+    std::vector<unsigned> search(const expression& exp, const word& w);
+
     /// The approximated behavior of an automaton.
     ///
     /// \param aut   the automaton whose behavior to approximate
@@ -61,12 +61,20 @@ namespace vcsn
         return !self_;
       }
 
+      /// Whether some states are lazy.  They are computed on demand,
+      /// possibly by const algorithms, which is not thread-safe.
+      bool has_lazy_states() const
+      {
+        return self_->has_lazy_states();
+      }
+
     private:
       /// Abstract wrapped typed automaton.
       struct base
       {
         virtual ~base() = default;
         virtual symbol vname() const = 0;
+        virtual bool has_lazy_states() const = 0;
       };
 
       /// A wrapped typed automaton.
@@ -84,6 +92,14 @@ namespace vcsn
           return automaton()->sname();
         }
 
+        bool has_lazy_states() const
+        {
+          for (auto s: automaton_->all_states())
+            if (automaton_->is_lazy(s) || automaton_->is_lazy_in(s))
+              return true;
+          return false;
+        }
+
         auto& automaton()
         {
           return automaton_;
@@ -139,6 +139,7 @@ namespace vcsn
 
   DEFINE(std::istream);
   DEFINE(const std::string);
+  DEFINE(const std::vector<std::string>);
   DEFINE(const std::vector<unsigned>);
   DEFINE(const std::set<std::pair<std::string, std::string>>);
   DEFINE(std::ostream);
@@ -5,6 +5,10 @@
 namespace vcsn
 {
 
+  // interned-wordset.hh.
+  template <typename GenSet>
+  class interned_wordset;
+
   // letterset.hh.
   template <typename GenSet>
   class letterset;
@@ -0,0 +1,673 @@
+#pragma once
+
+#include <memory>
+
+#include <boost/flyweight.hpp>
+#include <boost/flyweight/intermodule_holder.hpp>
+#include <boost/flyweight/no_tracking.hpp>
+#include <boost/optional.hpp>
+
+#include <vcsn/core/kind.hh>
+#include <vcsn/labelset/fwd.hh>
+#include <vcsn/labelset/wordset.hh>
+#include <vcsn/misc/attributes.hh>
+#include <vcsn/misc/functional.hh>
+#include <vcsn/misc/raise.hh>
+
+namespace vcsn
+{
+  namespace detail
+  {
+    /// An entry of the pool of words: the word, and its hash.
+    template <typename Word>
+    struct interned_word_entry
+    {
+      interned_word_entry(const Word& w)
+        : word{w}
+        , hash{hash_value(w)}
+      {}
+
+      friend bool operator==(const interned_word_entry& l,
+                             const interned_word_entry& r)
+      {
+        return l.hash == r.hash && l.word == r.word;
+      }
+
+      /// Used by the flyweight factory: do not hash the word twice.
+      friend size_t hash_value(const interned_word_entry& e)
+      {
+        return e.hash;
+      }
+
+      Word word;
+      size_t hash;
+    };
+
+    /// A word stored in a shared pool of words.
+    ///
+    /// Like vcsn::symbol, the pool is unique across modules
+    /// (since we dlopen plugins), and append-only: words are never
+    /// released.  Two interned words are equal iff they are the same
+    /// entry of the pool, and the hash of the word is computed once,
+    /// when it is inserted.
+    template <typename Word>
+    class interned_word
+    {
+    public:
+      using word_t = Word;
+      using entry_t = interned_word_entry<word_t>;
+      using flyweight_t
+        = boost::flyweight<entry_t,
+                           boost::flyweights::no_tracking,
+                           boost::flyweights::intermodule_holder>;
+      using const_iterator = typename word_t::const_iterator;
+
+      /// The empty word.
+      interned_word()
+        : interned_word{empty_()}
+      {}
+
+      interned_word(const word_t& w)
+        : fw_{entry_t{w}}
+      {}
+
+      interned_word(const_iterator b, const_iterator e)
+        : interned_word{word_t{b, e}}
+      {}
+
+      const word_t& word() const
+      {
+        return fw_.get().word;
+      }
+
+      size_t hash() const
+      {
+        return fw_.get().hash;
+      }
+
+      size_t size() const
+      {
+        return word().size();
+      }
+
+      bool empty() const
+      {
+        return word().empty();
+      }
+
+      const_iterator begin() const
+      {
+        return word().begin();
+      }
+
+      const_iterator end() const
+      {
+        return word().end();
+      }
+
+      friend bool operator==(const interned_word& l, const interned_word& r)
+      {
+        return &l.fw_.get() == &r.fw_.get();
+      }
+
+      friend bool operator!=(const interned_word& l, const interned_word& r)
+      {
+        return !(l == r);
+      }
+
+      /// Compare the words, not their address in the pool, so that
+      /// orders do not depend on the history of the pool.
+      friend bool operator<(const interned_word& l, const interned_word& r)
+      {
+        return l != r && l.word() < r.word();
+      }
+
+    private:
+      /// The interned empty word: it is the default value of labels,
+      /// and `one()`, so look it up only once.
+      static const interned_word& empty_()
+      {
+        static const auto res = interned_word{word_t{}};
+        return res;
+      }
+
+      flyweight_t fw_;
+    };
+  }
+
+  /// Implementation of labels are words, which are interned.
+  ///
+  /// Behaves like wordset, but the labels are handles on a shared
+  /// pool of words: they are cheap to copy, their comparison for
+  /// equality is constant-time, and their hash is precomputed.
+  /// Creating a label, however, requires a lookup in the pool.
+  template <typename GenSet>
+  class interned_wordset: public detail::genset_labelset<GenSet>
+  {
+  public:
+    using genset_t = GenSet;
+    using super_t = detail::genset_labelset<genset_t>;
+    using self_t = interned_wordset;
+    using genset_ptr = std::shared_ptr<const genset_t>;
+
+    using letter_t = typename genset_t::letter_t;
+    using word_t = typename genset_t::word_t;
+
+    using value_t = detail::interned_word<word_t>;
+
+    using kind_t = labels_are_words;
+
+    interned_wordset(const genset_ptr& gs)
+      : super_t{gs}
+    {}
+
+    interned_wordset(const genset_t& gs = {})
+      : interned_wordset{std::make_shared<const genset_t>(gs)}
+    {}
+
+    interned_wordset(std::initializer_list<letter_t> letters)
+      : interned_wordset(std::make_shared<const genset_t>(letters))
+    {}
+
+    static symbol sname()
+    {
+      static auto res = symbol{"interned_wordset<" + super_t::sname() + '>'};
+      return res;
+    }
+
+    /// Build from the description in \a is.
+    static interned_wordset make(std::istream& is)
+    {
+      // name: interned_wordset<char_letters(abc)>.
+      //       ^^^^^^^^^^^^^^^^ ^^^^^^^^^^^^^^^^^
+      //             kind             genset
+      eat(is, "interned_wordset<");
+      auto gs = genset_t::make(is);
+      eat(is, '>');
+      return gs;
+    }
+
+    /// Whether unknown letters should be added, or rejected.
+    /// \param o   whether to accept
+    /// \returns   the previous status.
+    bool open(bool o) const
+    {
+      return this->genset()->open(o);
+    }
+
+    static constexpr bool is_free()
+    {
+      return false;
+    }
+
+    /// Value constructor.
+    template <typename... Args>
+    value_t value(Args&&... args) const
+    {
+      return value_t{word_t{std::forward<Args>(args)...}};
+    }
+
+    /// Value constructor: already interned.
+    value_t value(value_t v) const
+    {
+      return v;
+    }
+
+    /// Convert to a word.
+    word_t word(const value_t& v) const
+    {
+      return v.word();
+    }
+
+    /// Prepare to iterate over the letters of v.
+    static const word_t&
+    letters_of(const value_t& v)
+    {
+      return v.word();
+    }
+
+    /// Prepare to iterate over the letters of v.
+    /// This is for the padded case
+    static const word_t&
+    letters_of_padded(const value_t& v, letter_t)
+    {
+      return v.word();
+    }
+
+    /// Three-way comparison between \a l and \a r.
+    static int compare(const value_t& l, const value_t& r)
+    {
+      return l == r ? 0 : genset_t::compare(l.word(), r.word());
+    }
+
+    /// Whether \a l == \a r.
+    static bool
+    equal(const value_t& l, const value_t& r)
+    {
+      return l == r;
+    }
+
+    /// Whether \a l < \a r.
+    static bool less(const letter_t& l, const letter_t& r)
+    {
+      return genset_t::less(l, r);
+    }
+
+    /// Whether \a l < \a r.
+    ///
+    /// The same order as wordset's.
+    static bool less(const value_t& l, const value_t& r)
+    {
+      if (l == r)
+        return false;
+      // Be sure to use genset::less().
+      auto s1 = size(l);
+      auto s2 = size(r);
+      if (s1 < s2)
+        return true;
+      else if (s2 < s1)
+        return false;
+      else
+        return genset_t::less(l.word(), r.word());
+    }
+
+    static value_t
+    special()
+    {
+      static const auto res
+        = value_t{genset_t::template special<word_t>()};
+      return res;
+    }
+
+    static bool
+    is_special(const value_t& v)
+    {
+      return v == special();
+    }
+
+    bool
+    is_valid(const value_t& v) const
+    {
+      for (auto l: v)
+        if (!this->has(l))
+          return false;
+      return true;
+    }
+
+    static constexpr bool
+    is_expressionset()
+    {
+      return false;
+    }
+
+    static constexpr bool
+    has_one()
+    {
+      return true;
+    }
+
+    static constexpr bool
+    is_letterized()
+    {
+      return false;
+    }
+
+    static value_t
+    one()
+    {
+      return {};
+    }
+
+    static bool
+    is_one(const value_t& l) ATTRIBUTE_PURE
+    {
+      return l == one();
+    }
+
+    static size_t size(const value_t& v)
+    {
+      return v.size();
+    }
+
+    static size_t hash(const value_t& v)
+    {
+      return v.hash();
+    }
+
+    /// Whether \a v is a letter.
+    bool is_letter(const value_t& v) const
+    {
+      return size(v) == 1;
+    }
+
+    /// The concatenation of \a l and \a r.
+    ///
+    /// Labels or letters.
+    template <typename Lhs, typename Rhs>
+    value_t
+    mul(const Lhs& l, const Rhs& r) const
+    {
+      return value_t{this->genset()->mul(word_(l), word_(r))};
+    }
+
+    /// Add the special character first and last.
+    value_t delimit(const value_t& v) const
+    {
+      return value_t{this->genset()->delimit(v.word())};
+    }
+
+    /// Remove first and last characters, that must be "special".
+    value_t undelimit(const value_t& v) const
+    {
+      return value_t{this->genset()->undelimit(v.word())};
+    }
+
+    /// The mirror of \a v.
+    value_t transpose(const value_t& v) const
+    {
+      return value_t{this->genset()->transpose(v.word())};
+    }
+
+    value_t
+    conv(self_t, const value_t& v) const
+    {
+      return v;
+    }
+
+    template <typename GenSet_>
+    value_t
+    conv(const wordset<GenSet_>& ls,
+         const typename wordset<GenSet_>::value_t& v) const
+    {
+      if (ls.is_special(v))
+        return special();
+      else
+        {
+          auto res = value_t{v};
+          VCSN_REQUIRE(is_valid(res),
+                       *this, ": conv: invalid label: ", str_escape(v));
+          return res;
+        }
+    }
+
+    template <typename GenSet_>
+    value_t
+    conv(const letterset<GenSet_>& ls,
+         typename letterset<GenSet_>::value_t v) const
+    {
+      if (ls.is_special(v))
+        return special();
+      else
+        {
+          auto res = value(v);
+          VCSN_REQUIRE(is_valid(res),
+                       *this, ": conv: invalid label: ", str_escape(v));
+          return res;
+        }
+    }
+
+    template <typename LabelSet_>
+    value_t
+    conv(const nullableset<LabelSet_>& ls,
+         const typename nullableset<LabelSet_>::value_t& v) const
+    {
+      if (ls.is_one(v))
+        return one();
+      else
+        return conv(*ls.labelset(), ls.get_value(v));
+    }
+
+    /// Read a word from this stream.
+    value_t
+    conv(std::istream& i, bool = true) const
+    {
+      return value_t{this->genset()->get_word(i)};
+    }
+
+    /// Process a label class.
+    ///
+    /// Stream \a i is right on a `[`.  Read up to the closing `]`,
+    /// and process the labels.
+    ///
+    /// For instance "[a-d0-9_]".
+    ///
+    /// \param i    the input stream.
+    /// \param fun  a (label_t) -> void function.
+    template <typename Fun>
+    void convs(std::istream& i, Fun fun) const
+    {
+      this->convs_(i, [this,fun](letter_t l) { fun(value(l)); });
+    }
+
+    std::ostream&
+    print(const value_t& l, std::ostream& o = std::cout,
+          format fmt = {}) const
+    {
+      if (is_one(l))
+        o << (fmt == format::latex ? "\\varepsilon"
+              : fmt == format::utf8 ? "ε"
+              : "\\e");
+      else if (!is_special(l))
+        this->genset()->print(l.word(), o, fmt);
+      return o;
+    }
+
+    std::ostream&
+    print_set(std::ostream& o, format fmt = {}) const
+    {
+      switch (fmt.kind())
+        {
+        case format::latex:
+          this->genset()->print_set(o, fmt);
+          o << "^*";
+          break;
+        case format::sname:
+          o << "interned_wordset<";
+          this->genset()->print_set(o, fmt);
+          o << '>';
+          break;
+        case format::text:
+        case format::utf8:
+          this->genset()->print_set(o, fmt);
+          o << '*';
+          break;
+        case format::raw:
+          assert(0);
+          break;
+        }
+      return o;
+    }
+
+    /// The longest common prefix.
+    static value_t lgcd(const value_t& w1, const value_t& w2)
+    {
+      if (w1 == w2)
+        return w1;
+      else
+        return {w1.begin(), boost::mismatch(w1.word(), w2.word()).first};
+    }
+
+    /// Compute w1 \ w2 = w1^{-1}w2.
+    /// Precondition: w1 is prefix of w2.
+    value_t ldivide(const value_t& w1, const value_t& w2) const
+    {
+      auto res = maybe_ldivide(w1, w2);
+      VCSN_REQUIRE(res,
+                   *this, ": ldivide: invalid arguments: ",
+                   to_string(*this, w1),
+                   ", ", to_string(*this, w2));
+      return *res;
+    }
+
+    boost::optional<value_t>
+    maybe_ldivide(const value_t& w1, const value_t& w2) const
+    {
+      using boost::algorithm::starts_with;
+      if (starts_with(w2.word(), w1.word()))
+        return value_t{w2.begin() + size(w1), w2.end()};
+      else
+        return boost::none;
+    }
+
+    /// w2 := w1 \ w2.
+    value_t& ldivide_here(const value_t& w1, value_t& w2) const
+    {
+      w2 = ldivide(w1, w2);
+      return w2;
+    }
+
+    /// Compute w1 / w2.
+    /// Precondition: w2 is suffix of w1.
+    value_t rdivide(const value_t& w1, const value_t& w2) const
+    {
+      auto res = maybe_rdivide(w1, w2);
+      VCSN_REQUIRE(res,
+                   *this, ": rdivide: invalid arguments: ",
+                   to_string(*this, w1),
+                   ", ", to_string(*this, w2));
+      return *res;
+    }
+
+    boost::optional<value_t>
+    maybe_rdivide(const value_t& w1, const value_t& w2) const
+    {
+      using boost::algorithm::ends_with;
+      if (ends_with(w1.word(), w2.word()))
+        return value_t{w1.begin(), w1.end() - size(w2)};
+      else
+        return boost::none;
+    }
+
+    /// w1 := w1 / w2.
+    value_t& rdivide_here(value_t& w1, const value_t& w2) const
+    {
+      w1 = rdivide(w1, w2);
+      return w1;
+    }
+
+    const value_t& conjunction(const value_t& l, const value_t& r) const
+    {
+      if (equal(l, r))
+        return l;
+      else
+        raise(*this,
+              ": conjunction: invalid operation (lhs and rhs are not equal): ",
+              to_string(*this, l), ", ", to_string(*this, r));
+    }
+
+  private:
+    static const word_t& word_(const value_t& v)
+    {
+      return v.word();
+    }
+
+    static letter_t word_(letter_t l)
+    {
+      return l;
+    }
+  };
+
+  namespace detail
+  {
+    /// Conversion to letterized.
+    template <typename GenSet>
+    struct letterized_traits<interned_wordset<GenSet>>
+    {
+      static constexpr bool is_letterized = false;
+
+      using labelset_t = nullableset<letterset<GenSet>>;
+
+      static labelset_t labelset(const interned_wordset<GenSet>& ls)
+      {
+        return {ls.genset()};
+      }
+    };
+
+    /// interned_wordset is already a nullableset.
+    template <typename GenSet>
+    struct nullableset_traits<interned_wordset<GenSet>>
+    {
+      using type = interned_wordset<GenSet>;
+      static type value(const interned_wordset<GenSet>& ls)
+      {
+        return ls;
+      }
+    };
+
+    template <typename GenSet>
+    struct law_traits<interned_wordset<GenSet>>
+    {
+      using type = interned_wordset<GenSet>;
+      static type value(const interned_wordset<GenSet>& ls)
+      {
+        return ls;
+      }
+    };
+
+    /*-------.
+    | Join.  |
+    `-------*/
+
+    /// Declare that Lhs v Rhs => Rhs (on the union of alphabets).
+#define DEFINE(Lhs, Rhs)                                  \
+    template <typename GenSet>                            \
+    struct join_impl<Lhs, Rhs>                            \
+    {                                                     \
+      using type = Rhs;                                   \
+      static type join(const Lhs& lhs, const Rhs& rhs)    \
+      {                                                   \
+        return {set_union(*lhs.genset(), *rhs.genset())}; \
+      }                                                   \
+    }
+
+    /// The join with another labelset.
+    DEFINE(letterset<GenSet>,              interned_wordset<GenSet>);
+    DEFINE(nullableset<letterset<GenSet>>, interned_wordset<GenSet>);
+    DEFINE(wordset<GenSet>,                interned_wordset<GenSet>);
+    DEFINE(interned_wordset<GenSet>,       interned_wordset<GenSet>);
+#undef DEFINE
+  }
+
+  /// Compute the meet with another alphabet.
+  template <typename GenSet>
+  interned_wordset<GenSet>
+  meet(const interned_wordset<GenSet>& lhs,
+       const interned_wordset<GenSet>& rhs)
+  {
+    return {set_intersection(*lhs.genset(), *rhs.genset())};
+  }
+
+
+  /*----------------.
+  | random_label.   |
+  `----------------*/
+
+  /// Random label from interned_wordset.
+  template <typename GenSet,
+            typename RandomGenerator = std::default_random_engine>
+  typename interned_wordset<GenSet>::value_t
+  random_label(const interned_wordset<GenSet>& ls,
+               RandomGenerator& gen = RandomGenerator())
+  {
+    require(!ls.generators().empty(),
+            "random_label: the alphabet needs at least 1 letter");
+    auto dis = std::uniform_int_distribution<>(0, 5);
+    auto res = ls.word(ls.one());
+    auto pick = make_random_selector(gen);
+    for (auto _: detail::irange(dis(gen)))
+      res = ls.genset()->mul(res, pick(ls.generators()));
+    return res;
+  }
+}
+
+namespace std
+{
+  template <typename Word>
+  struct hash<vcsn::detail::interned_word<Word>>
+  {
+    size_t operator()(const vcsn::detail::interned_word<Word>& v) const
+    {
+      return v.hash();
+    }
+  };
+}
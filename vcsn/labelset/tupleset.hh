@@ -1451,6 +1451,11 @@ namespace vcsn
     : std::true_type
   {};
 
+  template <typename... ValueSet>
+  struct is_thread_safe<tupleset<ValueSet...>>
+    : bool_constant<all_<is_thread_safe<ValueSet>::value...>()>
+  {};
+
   template <typename... ValueSets>
   struct number_of_tapes<tupleset<ValueSets...>>
   {
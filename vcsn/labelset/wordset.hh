@@ -224,6 +224,22 @@ namespace vcsn
         }
     }
 
+    template <typename GenSet_>
+    value_t
+    conv(const interned_wordset<GenSet_>& ls,
+         const typename interned_wordset<GenSet_>::value_t& v) const
+    {
+      if (ls.is_special(v))
+        return special();
+      else
+        {
+          auto res = ls.word(v);
+          VCSN_REQUIRE(is_valid(res),
+                       *this, ": conv: invalid label: ", str_escape(res));
+          return res;
+        }
+    }
+
     template <typename LabelSet_>
     value_t
     conv(const nullableset<LabelSet_>& ls,
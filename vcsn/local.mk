@@ -38,6 +38,7 @@ algo_headers =                                  \
   %D%/algos/detail/printer.hh                   \
   %D%/algos/determinize-expansion.hh            \
   %D%/algos/determinize.hh                      \
+  %D%/algos/dial.hh                             \
   %D%/algos/dijkstra-node.hh                    \
   %D%/algos/dijkstra.hh                         \
   %D%/algos/distance.hh                         \
@@ -55,7 +56,9 @@ algo_headers =                                  \
   %D%/algos/evaluate.hh                         \
   %D%/algos/expand.hh                           \
   %D%/algos/filter.hh                           \
+  %D%/algos/fingerprint.hh                      \
   %D%/algos/focus.hh                            \
+  %D%/algos/freeze.hh                           \
   %D%/algos/fwd.hh                              \
   %D%/algos/grail.hh                            \
   %D%/algos/guess-automaton-format.hh           \
@@ -88,9 +91,11 @@ algo_headers =                                  \
   %D%/algos/lightest-path.hh                    \
   %D%/algos/lightest.hh                         \
   %D%/algos/make-context.hh                     \
+  %D%/algos/match.hh                            \
   %D%/algos/minimize-brzozowski.hh              \
   %D%/algos/minimize-hopcroft.hh                \
   %D%/algos/minimize-moore.hh                   \
+  %D%/algos/minimize-signature-parallel.hh      \
   %D%/algos/minimize-signature.hh               \
   %D%/algos/minimize-weighted.hh                \
   %D%/algos/minimize.hh                         \
@@ -143,6 +148,7 @@ algo_headers =                                  \
   %D%/algos/tuple.hh                            \
   %D%/algos/u.hh                                \
   %D%/algos/universal.hh                        \
+  %D%/algos/vbin.hh                             \
   %D%/algos/weight-series.hh                    \
   %D%/algos/weight.hh                           \
   %D%/algos/zpc.hh
@@ -157,6 +163,7 @@ nobase_include_HEADERS =                        \
   %D%/core/automaton.hh                         \
   %D%/core/automatonset.hh                      \
   %D%/core/expression-automaton.hh              \
+  %D%/core/frozen-automaton.hh                  \
   %D%/core/fwd.hh                               \
   %D%/core/join-automata.hh                     \
   %D%/core/join.hh                              \
@@ -167,6 +174,7 @@ nobase_include_HEADERS =                        \
   %D%/core/partition-automaton.hh               \
   %D%/core/permutation-automaton.hh             \
   %D%/core/polystate-automaton.hh               \
+  %D%/core/property-cache.hh                    \
   %D%/core/rat/compare.hh                       \
   %D%/core/rat/copy.hh                          \
   %D%/core/rat/dot.hh                           \
@@ -230,6 +238,7 @@ nobase_include_HEADERS =                        \
   %D%/fwd.hh                                    \
   %D%/labelset/fwd.hh                           \
   %D%/labelset/genset-labelset.hh               \
+  %D%/labelset/interned-wordset.hh              \
   %D%/labelset/labelset.hh                      \
   %D%/labelset/letterset.hh                     \
   %D%/labelset/nullableset.hh                   \
@@ -239,6 +248,7 @@ nobase_include_HEADERS =                        \
   %D%/labelset/word-polynomialset.hh            \
   %D%/labelset/wordset.hh                       \
   %D%/misc/algorithm.hh                         \
+  %D%/misc/arena.hh                             \
   %D%/misc/attributes.hh                        \
   %D%/misc/bimap.hh                             \
   %D%/misc/builtins.hh                          \
@@ -269,14 +279,18 @@ nobase_include_HEADERS =                        \
   %D%/misc/irange.hh                            \
   %D%/misc/location.hh                          \
   %D%/misc/map.hh                               \
+  %D%/misc/mapped-file.hh                       \
   %D%/misc/math.hh                              \
   %D%/misc/memory.hh                            \
   %D%/misc/military-order.hh                    \
   %D%/misc/pair.hh                              \
+  %D%/misc/parallel.hh                          \
   %D%/misc/position.hh                          \
   %D%/misc/queue.hh                             \
+  %D%/misc/radix-heap.hh                        \
   %D%/misc/raise.hh                             \
   %D%/misc/random.hh                            \
+  %D%/misc/refinable-partition.hh               \
   %D%/misc/regex.hh                             \
   %D%/misc/set.hh                               \
   %D%/misc/set.hxx                              \
@@ -308,11 +322,13 @@ nobase_include_HEADERS =                        \
   %D%/weightset/nmin.hh                         \
   %D%/weightset/polynomialset.hh                \
   %D%/weightset/q.hh                            \
+  %D%/weightset/qh.hh                           \
   %D%/weightset/qmp.hh                          \
   %D%/weightset/r.hh                            \
   %D%/weightset/rmin.hh                         \
   %D%/weightset/weightset.hh                    \
   %D%/weightset/z.hh                            \
+  %D%/weightset/zh.hh                           \
   %D%/weightset/zmin.hh
 
 # Unfortunately Automake 1.14 does not generate this for us.
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace vcsn
+{
+  /// A memory pool for many small objects.
+  ///
+  /// Memory is obtained from the system by large blocks, and carved
+  /// into cells whose sizes are multiples of the maximum alignment.
+  /// Freed cells are kept in free lists (one per size) to be reused.
+  /// The blocks are released all at once, when the arena is
+  /// destroyed.
+  ///
+  /// Arenas are not meant to be handled directly, see make_arena: an
+  /// arena is kept alive as long as it has owners, or live cells.
+  class arena
+  {
+  public:
+    /// \param thread_safe
+    ///    whether allocate and deallocate may be called concurrently.
+    /// \param block_size
+    ///    the size of the blocks obtained from the system.
+    explicit arena(bool thread_safe = false, size_t block_size = 64 * 1024)
+      : block_size_{block_size}
+      , mutex_{thread_safe ? new std::mutex : nullptr}
+    {}
+
+    arena(const arena&) = delete;
+    arena& operator=(const arena&) = delete;
+
+    /// Release all the blocks at once.
+    ~arena() = default;
+
+    /// Allocate \a size bytes.
+    void* allocate(size_t size)
+    {
+      auto lock = lock_();
+      ++live_;
+      const auto n = num_cells_(size);
+      // Large objects are not worth pooling.
+      if (block_size_ < 4 * n * align_)
+        return ::operator new(size);
+      if (n < free_.size() && free_[n])
+        {
+          auto res = free_[n];
+          free_[n] = *static_cast<void**>(res);
+          return res;
+        }
+      if (end_ < cur_ + n * align_)
+        {
+          blocks_.emplace_back(new cell_[block_size_ / align_]);
+          cur_ = reinterpret_cast<char*>(blocks_.back().get());
+          end_ = cur_ + block_size_ / align_ * align_;
+        }
+      auto res = cur_;
+      cur_ += n * align_;
+      return res;
+    }
+
+    /// Give back \a p, of \a size bytes.
+    ///
+    /// If the arena has no owner anymore and this was its last live
+    /// cell, the arena is destroyed.
+    void deallocate(void* p, size_t size) noexcept
+    {
+      bool done = false;
+      {
+        auto lock = lock_();
+        const auto n = num_cells_(size);
+        if (block_size_ < 4 * n * align_)
+          ::operator delete(p);
+        else
+          {
+            if (free_.size() <= n)
+              free_.resize(n + 1, nullptr);
+            *static_cast<void**>(p) = free_[n];
+            free_[n] = p;
+          }
+        done = !--live_ && orphan_;
+      }
+      if (done)
+        delete this;
+    }
+
+    /// The arena has no owners anymore: destroy it now if it has no
+    /// live cells, otherwise when the last one is deallocated.
+    void release() noexcept
+    {
+      bool done = false;
+      {
+        auto lock = lock_();
+        orphan_ = true;
+        done = !live_;
+      }
+      if (done)
+        delete this;
+    }
+
+    /// The number of live cells.
+    size_t size() const
+    {
+      auto lock = lock_();
+      return live_;
+    }
+
+  private:
+    /// The type of the cells, to get the right alignment.
+    using cell_ = std::max_align_t;
+    /// The alignment of the cells, and the granularity of the sizes.
+    static constexpr size_t align_ = alignof(cell_);
+
+    /// The number of alignment units needed to store \a size bytes.
+    static size_t num_cells_(size_t size)
+    {
+      return (size + align_ - 1) / align_;
+    }
+
+    /// Lock the mutex, if there is one.
+    std::unique_lock<std::mutex> lock_() const
+    {
+      return mutex_
+        ? std::unique_lock<std::mutex>{*mutex_}
+        : std::unique_lock<std::mutex>{};
+    }
+
+    /// The size of the blocks.
+    size_t block_size_;
+    /// The blocks obtained from the system.
+    std::vector<std::unique_ptr<cell_[]>> blocks_;
+    /// The free part of the current block.
+    char* cur_ = nullptr;
+    char* end_ = nullptr;
+    /// The heads of the free lists, indexed by number of cells.
+    std::vector<void*> free_;
+    /// The number of cells allocated and not deallocated.
+    size_t live_ = 0;
+    /// Whether the arena has no owner anymore.
+    bool orphan_ = false;
+    /// The mutex, if thread-safe.
+    mutable std::unique_ptr<std::mutex> mutex_;
+  };
+
+  /// Build an arena, owned by the result.
+  ///
+  /// When the last owner is destroyed, the arena is destroyed as
+  /// soon as all its cells are deallocated.
+  inline
+  std::shared_ptr<arena>
+  make_arena(bool thread_safe = false)
+  {
+    return {new arena{thread_safe}, [](arena* a) { a->release(); }};
+  }
+
+  /// A standard allocator that allocates from an arena.
+  ///
+  /// Each allocated object keeps the arena alive, see arena::release.
+  template <typename T>
+  class arena_allocator
+  {
+  public:
+    using value_type = T;
+
+    arena_allocator(arena& a) noexcept
+      : arena_{&a}
+    {}
+
+    template <typename U>
+    arena_allocator(const arena_allocator<U>& that) noexcept
+      : arena_{that.arena_}
+    {}
+
+    T* allocate(size_t n)
+    {
+      return static_cast<T*>(arena_->allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept
+    {
+      arena_->deallocate(p, n * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const arena_allocator<U>& that) const noexcept
+    {
+      return arena_ == that.arena_;
+    }
+
+    template <typename U>
+    bool operator!=(const arena_allocator<U>& that) const noexcept
+    {
+      return !operator==(that);
+    }
+
+  private:
+    template <typename U>
+    friend class arena_allocator;
+    arena* arena_;
+  };
+}
@@ -17,3 +17,29 @@
   } while (false)
 
 #endif
+
+/// The number of trailing zero bits in \a X, an unsigned long long
+/// which must not be null.
+#if defined __clang__ || defined __GNUC__
+
+# define BUILTIN_CTZLL(X) __builtin_ctzll(X)
+
+#else
+
+# define BUILTIN_CTZLL(X) ::vcsn::detail::ctzll(X)
+
+namespace vcsn
+{
+  namespace detail
+  {
+    inline int ctzll(unsigned long long x)
+    {
+      int res = 0;
+      for (; !(x & 1); x >>= 1)
+        ++res;
+      return res;
+    }
+  }
+}
+
+#endif
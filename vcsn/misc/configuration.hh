@@ -4,6 +4,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <mutex>
 
 #include <boost/any.hpp>
 
@@ -99,6 +100,17 @@ namespace vcsn LIBVCSN_API
     return conf;
   }
 
+  /// The mutex to lock to access the configuration concurrently.
+  ///
+  /// Reading the configuration may modify it (e.g., the dot styles
+  /// are resolved on demand).
+  inline
+  std::mutex& get_config_mutex()
+  {
+    static std::mutex res;
+    return res;
+  }
+
   /// Get the string mapped by key (e.g., "configuration.version",
   /// "dot.styles").
   std::string configuration(const std::string& key);
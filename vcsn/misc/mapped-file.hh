@@ -0,0 +1,73 @@
+#pragma once
+
+#include <istream>
+#include <memory> // shared_ptr
+#include <streambuf>
+#include <string>
+
+#include <vcsn/misc/export.hh>
+
+namespace vcsn LIBVCSN_API
+{
+  /// A read-only stream buffer on a memory region.
+  ///
+  /// Contrary to std::stringbuf, the contents are not copied, and
+  /// readers aware of it can access the region directly.
+  class memory_streambuf: public std::streambuf
+  {
+  public:
+    memory_streambuf(const char* begin, const char* end)
+    {
+      // The get area is never written to.
+      setg(const_cast<char*>(begin), const_cast<char*>(begin),
+           const_cast<char*>(end));
+    }
+
+    /// The current position.
+    const char* current() const
+    {
+      return gptr();
+    }
+
+    /// The end of the region.
+    const char* end() const
+    {
+      return egptr();
+    }
+
+    /// Move the current position to \a p.
+    void seek(const char* p)
+    {
+      setg(eback(), const_cast<char*>(p), egptr());
+    }
+
+  protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                     std::ios_base::openmode which) override
+    {
+      auto base
+        = dir == std::ios_base::beg ? eback()
+        : dir == std::ios_base::cur ? gptr()
+        : egptr();
+      if (!(which & std::ios_base::in)
+          || off < eback() - base || egptr() - base < off)
+        return pos_type(off_type(-1));
+      seek(base + off);
+      return pos_type(gptr() - eback());
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+    {
+      return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+  };
+
+  /// Open \a file for reading and return its autoclosing stream.
+  ///
+  /// Regular files are mapped in memory, and read through a
+  /// memory_streambuf.  Otherwise, behave as open_input_file.
+  ///
+  /// \param file   the file name.  "-" and "" denote stdin.
+  /// \throws std::runtime_error on failure.
+  std::shared_ptr<std::istream> open_mapped_file(const std::string& file);
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace vcsn
+{
+  namespace detail
+  {
+    /// The number of threads to use when \a n are requested.
+    ///
+    /// 0 stands for the number of hardware threads (at least one).
+    inline unsigned num_threads(unsigned n)
+    {
+      return n ? n : std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    /// Call `fun(i, b, e)` on chunk number `i`, covering `[b, e)`, of
+    /// the range `[0, size)` split into (at most) `n` contiguous
+    /// chunks, each one in its own thread.
+    ///
+    /// If one of the calls throws, the first exception (in chunk
+    /// order) is rethrown once all the threads are finished.
+    ///
+    /// \returns  the number of chunks.
+    template <typename Fun>
+    size_t parallel_chunks(size_t size, unsigned n, Fun fun)
+    {
+      const size_t num = std::max(size_t{1},
+                                  std::min(size_t{num_threads(n)}, size));
+      if (num == 1)
+        {
+          fun(size_t{0}, size_t{0}, size);
+          return 1;
+        }
+      auto errors = std::vector<std::exception_ptr>(num);
+      auto threads = std::vector<std::thread>{};
+      threads.reserve(num);
+      for (size_t i = 0; i < num; ++i)
+        threads.emplace_back([&, i]
+                             {
+                               try
+                                 {
+                                   fun(i, size * i / num, size * (i + 1) / num);
+                                 }
+                               catch (...)
+                                 {
+                                   errors[i] = std::current_exception();
+                                 }
+                             });
+      for (auto& t: threads)
+        t.join();
+      for (const auto& e: errors)
+        if (e)
+          std::rethrow_exception(e);
+      return num;
+    }
+
+    /// Call `fun(i)` for each `i` in `[0, size)`, using (at most) `n`
+    /// threads.
+    ///
+    /// The indexes are dispatched dynamically, by blocks of `grain`:
+    /// a thread that is done with its block takes the next one, so
+    /// the load is balanced even when the cost of `fun(i)` varies a
+    /// lot.
+    template <typename Fun>
+    void parallel_for(size_t size, unsigned n, Fun fun, size_t grain = 1)
+    {
+      const size_t num_blocks = (size + grain - 1) / grain;
+      std::atomic<size_t> next{0};
+      parallel_chunks(num_blocks, n,
+                      [&](size_t, size_t, size_t)
+                      {
+                        for (size_t b = next++; b < num_blocks; b = next++)
+                          for (size_t i = b * grain,
+                                 e = std::min(size, (b + 1) * grain);
+                               i < e; ++i)
+                            fun(i);
+                      });
+    }
+  }
+}
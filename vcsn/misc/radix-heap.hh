@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace vcsn
+{
+  /// A monotone min-priority queue on unsigned integer keys.
+  ///
+  /// The keys pushed must not be less than the last key popped,
+  /// which is the case of Dijkstra's algorithm with nonnegative
+  /// weights.  The elements are kept in buckets according to the most
+  /// significant bit by which their key differs from the last key
+  /// popped: each element moves at most once per bit of the key,
+  /// and the buckets are plain vectors.
+  ///
+  /// See "Faster algorithms for the shortest path problem", Ahuja,
+  /// Mehlhorn, Orlin and Tarjan, Journal of the ACM, 37(2), 1990.
+  template <typename Key, typename Value>
+  class radix_heap
+  {
+  public:
+    static_assert(std::is_unsigned<Key>::value,
+                  "radix_heap: keys must be unsigned");
+    using key_t = Key;
+    using value_t = Value;
+    using elt_t = std::pair<key_t, value_t>;
+
+    bool empty() const
+    {
+      return !size_;
+    }
+
+    size_t size() const
+    {
+      return size_;
+    }
+
+    /// Insert \a v with key \a k.
+    void emplace(key_t k, value_t v)
+    {
+      assert(last_ <= k);
+      buckets_[bucket_(k)].emplace_back(k, v);
+      ++size_;
+    }
+
+    /// Remove an element with the smallest key, and return it.
+    elt_t pop()
+    {
+      assert(!empty());
+      if (buckets_[0].empty())
+        {
+          auto i = size_t{1};
+          while (buckets_[i].empty())
+            ++i;
+          // The new minimum, and redistribute its bucket: all its
+          // elements go to lower buckets.
+          auto& b = buckets_[i];
+          last_ = b[0].first;
+          for (const auto& e: b)
+            if (e.first < last_)
+              last_ = e.first;
+          for (const auto& e: b)
+            buckets_[bucket_(e.first)].emplace_back(e);
+          b.clear();
+        }
+      auto res = buckets_[0].back();
+      buckets_[0].pop_back();
+      --size_;
+      return res;
+    }
+
+  private:
+    static constexpr size_t bits_ = std::numeric_limits<key_t>::digits;
+
+    /// The index of the bucket of key \a k: 0 if it is last_,
+    /// otherwise one plus the rank of the highest bit by which they
+    /// differ.
+    size_t bucket_(key_t k) const
+    {
+      using ull = unsigned long long;
+      static_assert(bits_ <= std::numeric_limits<ull>::digits,
+                    "radix_heap: keys are too large");
+      auto x = static_cast<ull>(k ^ last_);
+      return x ? std::numeric_limits<ull>::digits - __builtin_clzll(x) : 0;
+    }
+
+    std::array<std::vector<elt_t>, bits_ + 1> buckets_;
+    key_t last_ = 0;
+    size_t size_ = 0;
+  };
+}
@@ -28,6 +28,21 @@ namespace vcsn
     using void_t = void;
 #endif
 
+    /// The type \a T, artificially dependent on \a Ts.
+    ///
+    /// Used in the declaration of member function templates to delay
+    /// the checks on \a T until the function is actually used.  This
+    /// allows, for instance, decorators to forward mutating members
+    /// that a (read-only) decorated automaton does not provide.
+    template <typename T, typename... Ts>
+    struct dependent_type
+    {
+      using type = T;
+    };
+
+    template <typename T, typename... Ts>
+    using dependent_t = typename dependent_type<T, Ts...>::type;
+
     // Primary template handles all types not supporting the operation.
     template <typename, template <typename> class, typename = void_t<>>
     struct detect : std::false_type {};
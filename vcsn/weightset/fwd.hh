@@ -21,6 +21,9 @@ namespace vcsn
     // q.hh.
     class q_impl;
 
+    // qh.hh.
+    class qh_impl;
+
     // qmp.hh.
     class qmp_impl;
 
@@ -33,6 +36,9 @@ namespace vcsn
     // z.hh.
     class z_impl;
 
+    // zh.hh.
+    class zh_impl;
+
     // zmin.hh.
     class zmin_impl;
 
@@ -50,10 +56,12 @@ namespace vcsn
   using log  = weightset_mixin<detail::log_impl>;
   using nmin = weightset_mixin<detail::nmin_impl>;
   using q    = weightset_mixin<detail::q_impl>;
+  using qh   = weightset_mixin<detail::qh_impl>;
   using qmp  = weightset_mixin<detail::qmp_impl>;
   using r    = weightset_mixin<detail::r_impl>;
   using rmin = weightset_mixin<detail::rmin_impl>;
   using z    = weightset_mixin<detail::z_impl>;
+  using zh   = weightset_mixin<detail::zh_impl>;
   using zmin = weightset_mixin<detail::zmin_impl>;
 
   template <typename Context,
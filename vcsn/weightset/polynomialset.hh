@@ -1627,4 +1627,9 @@ namespace vcsn
       }
     };
   }
+
+  template <typename Context, wet_kind_t Kind>
+  struct is_thread_safe<polynomialset<Context, Kind>>
+    : is_thread_safe<Context>
+  {};
 }
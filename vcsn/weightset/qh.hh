@@ -0,0 +1,507 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <string>
+
+#include <cstddef> // https://gcc.gnu.org/gcc-4.9/porting_to.html
+#include <gmpxx.h>
+
+#include <vcsn/core/join.hh>
+#include <vcsn/misc/format.hh>
+#include <vcsn/misc/functional.hh> // hash_combine
+#include <vcsn/misc/raise.hh>
+#include <vcsn/misc/star-status.hh>
+#include <vcsn/misc/stream.hh> // eat
+#include <vcsn/misc/symbol.hh>
+#include <vcsn/weightset/b.hh>
+#include <vcsn/weightset/fwd.hh>
+#include <vcsn/weightset/q.hh>
+#include <vcsn/weightset/weightset.hh>
+#include <vcsn/weightset/z.hh>
+#include <vcsn/weightset/zh.hh>
+
+namespace vcsn
+{
+  namespace detail
+  {
+  /// Rationals, stored inline as pairs of 64-bit integers, and
+  /// transparently promoted to GMP rationals when an operation
+  /// overflows.
+  class qh_impl
+  {
+  public:
+    using self_t = qh;
+
+    static symbol sname()
+    {
+      static auto res = symbol{"qh"};
+      return res;
+    }
+
+    /// Build from the description in \a is.
+    static qh make(std::istream& is)
+    {
+      eat(is, sname());
+      return {};
+    }
+
+    using int_t = std::int64_t;
+
+    /// A rational.
+    ///
+    /// Values whose (reduced) numerator and denominator fit in 64
+    /// bits are always stored inline: the representation is unique,
+    /// and the GMP rational is allocated only for larger values.
+    class value_t
+    {
+    public:
+      /// \pre num and den are coprime, and 0 < den.
+      value_t(int_t num = 0, int_t den = 1)
+        : num_{num}
+        , den_{den}
+      {}
+
+      /// \pre v is canonical.
+      value_t(const mpq_class& v)
+      {
+        if (v.get_num().fits_slong_p() && v.get_den().fits_slong_p())
+          {
+            num_ = v.get_num().get_si();
+            den_ = v.get_den().get_si();
+          }
+        else
+          big_ = std::make_shared<const mpq_class>(v);
+      }
+
+      /// Whether the value is stored inline.
+      bool is_small() const
+      {
+        return !big_;
+      }
+
+      /// The numerator, if is_small().
+      int_t num() const
+      {
+        return num_;
+      }
+
+      /// The denominator, if is_small().
+      int_t den() const
+      {
+        return den_;
+      }
+
+      /// The value, if !is_small().
+      const mpq_class& big() const
+      {
+        return *big_;
+      }
+
+      /// The value, as a GMP rational.
+      mpq_class get_mpq() const
+      {
+        return big_ ? *big_ : mpq_class{to_mpz(num_), to_mpz(den_)};
+      }
+
+    private:
+      int_t num_ = 0;
+      int_t den_ = 1;
+      std::shared_ptr<const mpq_class> big_;
+    };
+
+    /// Create rational weight from num and den.
+    static value_t value(int_t num, int_t den)
+    {
+      auto res = mpq_class{to_mpz(num), to_mpz(den)};
+      res.canonicalize();
+      return res;
+    }
+
+    static value_t zero()
+    {
+      return value_t{0, 1};
+    }
+
+    static value_t one()
+    {
+      return value_t{1, 1};
+    }
+
+    static value_t min()
+    {
+      return value_t{std::numeric_limits<int_t>::min(), 1};
+    }
+
+    static value_t max()
+    {
+      return value_t{std::numeric_limits<int_t>::max(), 1};
+    }
+
+    static value_t add(const value_t& l, const value_t& r)
+    {
+      if (l.is_small() && r.is_small())
+        {
+          // l + r = (ln * (rd/g) + rn * (ld/g)) / (ld * (rd/g)).
+          auto g = gcd_(l.den(), r.den());
+          int_t a, b, num, den;
+          if (!__builtin_mul_overflow(l.num(), r.den() / g, &a)
+              && !__builtin_mul_overflow(r.num(), l.den() / g, &b)
+              && !__builtin_add_overflow(a, b, &num)
+              && !__builtin_mul_overflow(l.den(), r.den() / g, &den)
+              && num != std::numeric_limits<int_t>::min())
+            return reduce_(num, den);
+        }
+      return mpq_class{l.get_mpq() + r.get_mpq()};
+    }
+
+    static value_t sub(const value_t& l, const value_t& r)
+    {
+      return add(l, neg_(r));
+    }
+
+    static value_t mul(const value_t& l, const value_t& r)
+    {
+      if (l.is_small() && r.is_small()
+          && l.num() != std::numeric_limits<int_t>::min()
+          && r.num() != std::numeric_limits<int_t>::min())
+        {
+          // Cross-reduce, so that the result is reduced.
+          auto g1 = gcd_(abs_(l.num()), r.den());
+          auto g2 = gcd_(abs_(r.num()), l.den());
+          int_t num, den;
+          if (!__builtin_mul_overflow(l.num() / g1, r.num() / g2, &num)
+              && !__builtin_mul_overflow(l.den() / g2, r.den() / g1, &den))
+            return value_t{num, den};
+        }
+      return mpq_class{l.get_mpq() * r.get_mpq()};
+    }
+
+    /// GCD: arbitrarily the first argument.
+    value_t
+    lgcd(const value_t& l, const value_t& r) const
+    {
+      require(!is_zero(l), *this, ": lgcd: invalid lhs: zero");
+      require(!is_zero(r), *this, ": lgcd: invalid rhs: zero");
+      return l;
+    }
+
+    value_t
+    rgcd(const value_t& l, const value_t& r) const
+    {
+      return lgcd(l, r);
+    }
+
+    value_t
+    rdivide(const value_t& l, const value_t& r) const
+    {
+      require(!is_zero(r), *this, ": div: division by zero");
+      return mul(l, inv_(r));
+    }
+
+    value_t
+    ldivide(const value_t& l, const value_t& r) const
+    {
+      return rdivide(r, l);
+    }
+
+    value_t star(const value_t& v) const
+    {
+      // 1 / (1 - n/d) = d / (d - n).  No need to reduce: numerator
+      // and denominator are coprime.
+      int_t den;
+      if (v.is_small()
+          && v.num() != std::numeric_limits<int_t>::min()
+          && abs_(v.num()) < v.den()
+          && !__builtin_sub_overflow(v.den(), v.num(), &den))
+        return value_t{v.den(), den};
+      else if (::abs(v.get_mpq()) < 1)
+        {
+          const auto q = v.get_mpq();
+          return mpq_class{q.get_den(), q.get_den() - q.get_num()};
+        }
+      else
+        raise_not_starrable(*this, v);
+    }
+
+    static bool is_special(const value_t&) // C++11: cannot be constexpr.
+    {
+      return false;
+    }
+
+    static bool is_zero(const value_t& v)
+    {
+      return v.is_small() && v.num() == 0;
+    }
+
+    static bool is_one(const value_t& v)
+    {
+      // All values are normalized.
+      return v.is_small() && v.num() == 1 && v.den() == 1;
+    }
+
+    /// Three-way comparison between \a l and \a r.
+    static int compare(const value_t& l, const value_t& r)
+    {
+      if (l.is_small() && r.is_small())
+        {
+          // The cross products fit in 128 bits.
+          auto a = static_cast<__int128>(l.num()) * r.den();
+          auto b = static_cast<__int128>(r.num()) * l.den();
+          return (b < a) - (a < b);
+        }
+      else
+        return cmp(l.get_mpq(), r.get_mpq());
+    }
+
+    /// Whether \a l == \a r.
+    static bool equal(const value_t& l, const value_t& r)
+    {
+      // Values are normalized: a big value is never equal to a
+      // small one.
+      if (l.is_small() || r.is_small())
+        return (l.is_small() && r.is_small()
+                && l.num() == r.num() && l.den() == r.den());
+      else
+        return l.big() == r.big();
+    }
+
+    /// Whether \a l < \a r.
+    static bool less(const value_t& l, const value_t& r)
+    {
+      return compare(l, r) < 0;
+    }
+
+    static constexpr bool is_commutative() { return true; }
+    static constexpr bool has_lightening_weights() { return true; }
+
+    static constexpr bool show_one() { return false; }
+    static constexpr star_status_t star_status() { return star_status_t::ABSVAL; }
+
+    static value_t
+    abs(const value_t& v)
+    {
+      if (v.is_small() && v.num() != std::numeric_limits<int_t>::min())
+        return value_t{abs_(v.num()), v.den()};
+      else
+        return mpq_class{::abs(v.get_mpq())};
+    }
+
+    static value_t
+    transpose(const value_t& v)
+    {
+      return v;
+    }
+
+    static size_t hash(const value_t& v)
+    {
+      size_t res = 0;
+      if (v.is_small())
+        {
+          hash_combine(res, hash_value(v.num()));
+          hash_combine(res, hash_value(v.den()));
+        }
+      else
+        {
+          hash_combine(res, hash_mpz(v.big().get_num()));
+          hash_combine(res, hash_mpz(v.big().get_den()));
+        }
+      return res;
+    }
+
+    static value_t
+    conv(self_t, const value_t& v)
+    {
+      return v;
+    }
+
+    static value_t
+    conv(zh, const zh::value_t& v)
+    {
+      if (v.is_small())
+        return value_t{v.small(), 1};
+      else
+        return mpq_class{v.big()};
+    }
+
+    static value_t
+    conv(q, const q::value_t& v)
+    {
+      return value_t{v.num, v.den};
+    }
+
+    static value_t
+    conv(z, const z::value_t v)
+    {
+      return value_t{v, 1};
+    }
+
+    static value_t
+    conv(b, const b::value_t v)
+    {
+      return value_t{v, 1};
+    }
+
+    value_t
+    conv(std::istream& i, bool = true) const
+    {
+      mpz_class num;
+      if (!(i >> num))
+        raise(*this, ": invalid numerator: ", i);
+
+      // If we have a slash after the numerator then we have a
+      // denominator as well.
+      if (i.peek() == '/')
+        {
+          eat(i, '/');
+          mpz_class den;
+          if (!(i >> den))
+            raise(*this, ": invalid denominator: ", i);
+          // Make sure our rational respects our constraints.
+          require(den != 0, *this, ": null denominator");
+          auto res = mpq_class{num, den};
+          res.canonicalize();
+          return res;
+        }
+      else
+        return mpq_class{num};
+    }
+
+    static std::ostream&
+    print(const value_t& v, std::ostream& o = std::cout,
+          format fmt = {})
+    {
+      if (!v.is_small())
+        {
+          if (fmt == format::latex && v.big().get_den() != 1)
+            o << "\\frac{" << v.big().get_num()
+              << "}{" << v.big().get_den() << '}';
+          else
+            o << v.big();
+        }
+      else if (fmt == format::latex && v.den() != 1)
+        o << "\\frac{" << v.num() << "}{" << v.den() << '}';
+      else
+        {
+          o << v.num();
+          if (v.den() != 1)
+            o << '/' << v.den();
+        }
+      return o;
+    }
+
+    std::ostream&
+    print_set(std::ostream& o, format fmt = {}) const
+    {
+      switch (fmt.kind())
+        {
+        case format::latex:
+          o << "\\mathbb{Q}_{\\text{h}}";
+          break;
+        case format::sname:
+          o << sname();
+          break;
+        case format::text:
+          o << "Qh";
+          break;
+        case format::utf8:
+          o << "ℚh";
+          break;
+        case format::raw:
+          assert(0);
+          break;
+        }
+      return o;
+    }
+
+  private:
+    /// |v|, \pre v is not the minimal value.
+    static int_t abs_(int_t v)
+    {
+      return v < 0 ? -v : v;
+    }
+
+    /// Greatest common divisor of non-negative numbers.
+    static int_t gcd_(int_t a, int_t b)
+    {
+      while (b)
+        {
+          auto t = a % b;
+          a = b;
+          b = t;
+        }
+      return a;
+    }
+
+    /// num/den in normal form, \pre 0 < den, num is not the minimal
+    /// value.
+    static value_t reduce_(int_t num, int_t den)
+    {
+      auto g = gcd_(abs_(num), den);
+      return g == 1 ? value_t{num, den} : value_t{num / g, den / g};
+    }
+
+    /// -v.
+    static value_t neg_(const value_t& v)
+    {
+      if (v.is_small() && v.num() != std::numeric_limits<int_t>::min())
+        return value_t{-v.num(), v.den()};
+      else
+        return mpq_class{-v.get_mpq()};
+    }
+
+    /// 1/v, \pre v is not zero.
+    static value_t inv_(const value_t& v)
+    {
+      if (v.is_small() && v.num() != std::numeric_limits<int_t>::min())
+        return (0 < v.num()
+                ? value_t{v.den(), v.num()}
+                : value_t{-v.den(), -v.num()});
+      else
+        return mpq_class{1 / v.get_mpq()};
+    }
+  };
+
+    /// Random generation.
+    template <typename RandomGenerator>
+    class random_weight<qh, RandomGenerator>
+      : public random_weight_base<qh, RandomGenerator>
+    {
+    public:
+      using super_t = random_weight_base<qh, RandomGenerator>;
+      using value_t = typename super_t::weight_t;
+
+      using super_t::super_t;
+
+    private:
+      value_t pick_value_() const override
+      {
+        require(super_t::min_.is_small() && super_t::max_.is_small(),
+                super_t::ws_, ": random_weight: bounds are too large");
+        using int_t = qh_impl::int_t;
+        auto dis_num
+          = std::uniform_int_distribution<int_t>(super_t::min_.num(),
+                                                 super_t::max_.num());
+        auto dis_den
+          = std::uniform_int_distribution<int_t>(super_t::min_.den(),
+                                                 super_t::max_.num());
+        auto num = dis_num(super_t::gen_);
+        auto den = dis_den(super_t::gen_);
+        return super_t::ws_.value(num, den);
+      }
+    };
+
+
+    /*-------.
+    | join.  |
+    `-------*/
+
+    VCSN_JOIN_SIMPLE(b, qh);
+    VCSN_JOIN_SIMPLE(z, qh);
+    VCSN_JOIN_SIMPLE(q, qh);
+    VCSN_JOIN_SIMPLE(zh, qh);
+    VCSN_JOIN_SIMPLE(qh, qh);
+  }
+}
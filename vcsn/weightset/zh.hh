@@ -0,0 +1,388 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <string>
+
+#include <cstddef> // https://gcc.gnu.org/gcc-4.9/porting_to.html
+#include <gmpxx.h>
+
+#include <vcsn/core/join.hh>
+#include <vcsn/misc/format.hh>
+#include <vcsn/misc/functional.hh> // hash_combine
+#include <vcsn/misc/raise.hh>
+#include <vcsn/misc/star-status.hh>
+#include <vcsn/misc/stream.hh> // eat
+#include <vcsn/misc/symbol.hh>
+#include <vcsn/weightset/b.hh>
+#include <vcsn/weightset/fwd.hh>
+#include <vcsn/weightset/weightset.hh>
+#include <vcsn/weightset/z.hh>
+
+namespace vcsn
+{
+  namespace detail
+  {
+    /// The hash of a GMP integer.
+    inline size_t hash_mpz(const mpz_class& v)
+    {
+      size_t res = 0;
+      hash_combine(res, mpz_sgn(v.get_mpz_t()));
+      for (size_t i = 0, n = mpz_size(v.get_mpz_t()); i < n; ++i)
+        hash_combine(res, mpz_getlimbn(v.get_mpz_t(), i));
+      return res;
+    }
+
+    /// Convert a 64-bit integer into a GMP integer.
+    inline mpz_class to_mpz(std::int64_t v)
+    {
+      static_assert(sizeof(std::int64_t) <= sizeof(long),
+                    "zh: requires 64-bit longs");
+      return mpz_class{static_cast<long>(v)};
+    }
+
+  /// Integers, stored inline as 64-bit integers, and transparently
+  /// promoted to GMP integers when an operation overflows.
+  class zh_impl
+  {
+  public:
+    using self_t = zh;
+
+    static symbol sname()
+    {
+      static auto res = symbol{"zh"};
+      return res;
+    }
+
+    /// Build from the description in \a is.
+    static zh make(std::istream& is)
+    {
+      eat(is, sname());
+      return {};
+    }
+
+    /// An integer.
+    ///
+    /// Values that fit in 64 bits are always stored inline: the
+    /// representation is unique, and the GMP integer is allocated
+    /// only for larger values.
+    class value_t
+    {
+    public:
+      value_t(std::int64_t v = 0)
+        : small_{v}
+      {}
+
+      value_t(const mpz_class& v)
+      {
+        if (v.fits_slong_p())
+          small_ = v.get_si();
+        else
+          big_ = std::make_shared<const mpz_class>(v);
+      }
+
+      /// Whether the value is stored inline.
+      bool is_small() const
+      {
+        return !big_;
+      }
+
+      /// The value, if is_small().
+      std::int64_t small() const
+      {
+        return small_;
+      }
+
+      /// The value, if !is_small().
+      const mpz_class& big() const
+      {
+        return *big_;
+      }
+
+      /// The value, as a GMP integer.
+      mpz_class get_mpz() const
+      {
+        return big_ ? *big_ : to_mpz(small_);
+      }
+
+    private:
+      std::int64_t small_ = 0;
+      std::shared_ptr<const mpz_class> big_;
+    };
+
+    static value_t
+    zero()
+    {
+      return 0;
+    }
+
+    static value_t
+    one()
+    {
+      return 1;
+    }
+
+    static value_t
+    min()
+    {
+      return std::numeric_limits<std::int64_t>::min();
+    }
+
+    static value_t
+    max()
+    {
+      return std::numeric_limits<std::int64_t>::max();
+    }
+
+    static value_t
+    add(const value_t& l, const value_t& r)
+    {
+      std::int64_t res;
+      if (l.is_small() && r.is_small()
+          && !__builtin_add_overflow(l.small(), r.small(), &res))
+        return res;
+      else
+        return mpz_class{l.get_mpz() + r.get_mpz()};
+    }
+
+    static value_t
+    sub(const value_t& l, const value_t& r)
+    {
+      std::int64_t res;
+      if (l.is_small() && r.is_small()
+          && !__builtin_sub_overflow(l.small(), r.small(), &res))
+        return res;
+      else
+        return mpz_class{l.get_mpz() - r.get_mpz()};
+    }
+
+    static value_t
+    mul(const value_t& l, const value_t& r)
+    {
+      std::int64_t res;
+      if (l.is_small() && r.is_small()
+          && !__builtin_mul_overflow(l.small(), r.small(), &res))
+        return res;
+      else
+        return mpz_class{l.get_mpz() * r.get_mpz()};
+    }
+
+    value_t
+    lgcd(const value_t& l, const value_t& r) const
+    {
+      require(!is_zero(l), *this, ": lgcd: invalid lhs: zero");
+      require(!is_zero(r), *this, ": lgcd: invalid rhs: zero");
+      return mpz_class{gcd(l.get_mpz(), r.get_mpz())};
+    }
+
+    value_t
+    rgcd(const value_t& l, const value_t& r) const
+    {
+      return lgcd(l, r);
+    }
+
+    value_t
+    rdivide(const value_t& l, const value_t& r) const
+    {
+      require(!is_zero(r), *this, ": div: division by zero");
+      // Beware of min / -1.
+      if (l.is_small() && r.is_small() && r.small() != -1)
+        {
+          require(!(l.small() % r.small()),
+                  *this, ": div: invalid division: ", l.small(),
+                  '/', r.small());
+          return l.small() / r.small();
+        }
+      else
+        {
+          auto ln = l.get_mpz();
+          auto rn = r.get_mpz();
+          require(mpz_divisible_p(ln.get_mpz_t(), rn.get_mpz_t()),
+                  *this, ": div: invalid division: ", ln, '/', rn);
+          return mpz_class{ln / rn};
+        }
+    }
+
+    value_t
+    ldivide(const value_t& l, const value_t& r) const
+    {
+      return rdivide(r, l);
+    }
+
+    value_t
+    star(const value_t& v) const
+    {
+      if (is_zero(v))
+        return one();
+      else
+        raise_not_starrable(*this, v);
+    }
+
+    static bool is_special(const value_t&) // C++11: cannot be constexpr.
+    {
+      return false;
+    }
+
+    static bool
+    is_zero(const value_t& v)
+    {
+      return v.is_small() && v.small() == 0;
+    }
+
+    static bool
+    is_one(const value_t& v)
+    {
+      return v.is_small() && v.small() == 1;
+    }
+
+    /// Three-way comparison between \a l and \a r.
+    static int compare(const value_t& l, const value_t& r)
+    {
+      if (l.is_small() && r.is_small())
+        return (r.small() < l.small()) - (l.small() < r.small());
+      else
+        return sgn(l.get_mpz() - r.get_mpz());
+    }
+
+    /// Whether \a l == \a r.
+    static bool
+    equal(const value_t& l, const value_t& r)
+    {
+      // Values are normalized: a big value is never equal to a
+      // small one.
+      if (l.is_small() || r.is_small())
+        return l.is_small() && r.is_small() && l.small() == r.small();
+      else
+        return l.big() == r.big();
+    }
+
+    /// Whether \a lhs < \a rhs.
+    static bool less(const value_t& lhs, const value_t& rhs)
+    {
+      return compare(lhs, rhs) < 0;
+    }
+
+    static constexpr bool is_commutative() { return true; }
+    static constexpr bool is_idempotent() { return false; }
+    static constexpr bool has_lightening_weights() { return true; }
+
+    static constexpr bool show_one() { return false; }
+    static constexpr star_status_t star_status() { return star_status_t::NON_STARRABLE; }
+
+    static value_t
+    abs(const value_t& v)
+    {
+      if (v.is_small() && v.small() != std::numeric_limits<std::int64_t>::min())
+        return v.small() < 0 ? -v.small() : v.small();
+      else
+        return mpz_class{::abs(v.get_mpz())};
+    }
+
+    static value_t
+    transpose(const value_t& v)
+    {
+      return v;
+    }
+
+    static size_t hash(const value_t& v)
+    {
+      return v.is_small() ? hash_value(v.small()) : hash_mpz(v.big());
+    }
+
+    static value_t
+    conv(self_t, const value_t& v)
+    {
+      return v;
+    }
+
+    static value_t
+    conv(z, z::value_t v)
+    {
+      return v;
+    }
+
+    static value_t
+    conv(b, b::value_t v)
+    {
+      return v;
+    }
+
+    value_t
+    conv(std::istream& is, bool = true) const
+    {
+      mpz_class res;
+      if (is >> res)
+        return res;
+      else
+        raise_invalid_value(*this, is);
+    }
+
+    static std::ostream&
+    print(const value_t& v, std::ostream& o = std::cout,
+          format = {})
+    {
+      if (v.is_small())
+        return o << v.small();
+      else
+        return o << v.big();
+    }
+
+    std::ostream&
+    print_set(std::ostream& o, format fmt = {}) const
+    {
+      switch (fmt.kind())
+        {
+        case format::latex:
+          o << "\\mathbb{Z}_{\\text{h}}";
+          break;
+        case format::sname:
+          o << sname();
+          break;
+        case format::text:
+          o << "Zh";
+          break;
+        case format::utf8:
+          o << "ℤh";
+          break;
+        case format::raw:
+          assert(0);
+          break;
+        }
+      return o;
+    }
+  };
+
+    /// Random generation.
+    template <typename RandomGenerator>
+    class random_weight<zh, RandomGenerator>
+      : public random_weight_base<zh, RandomGenerator>
+    {
+    public:
+      using super_t = random_weight_base<zh, RandomGenerator>;
+      using value_t = typename super_t::weight_t;
+
+      using super_t::super_t;
+
+    private:
+      value_t pick_value_() const override
+      {
+        require(super_t::min_.is_small() && super_t::max_.is_small(),
+                super_t::ws_, ": random_weight: bounds are too large");
+        auto dis
+          = std::uniform_int_distribution<std::int64_t>(super_t::min_.small(),
+                                                        super_t::max_.small());
+        return dis(super_t::gen_);
+      }
+    };
+
+    /*-------.
+    | join.  |
+    `-------*/
+
+    VCSN_JOIN_SIMPLE(b, zh);
+    VCSN_JOIN_SIMPLE(z, zh);
+    VCSN_JOIN_SIMPLE(zh, zh);
+  }
+}